@@ -0,0 +1,433 @@
+#include "Aot.h"
+#include "Jit.h"
+
+#include <cerrno>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/wait.h>
+#include <unistd.h>
+#define THISFUNC_SPAWN
+#endif
+
+namespace
+{
+	/// The part of the generated file that does not depend on the definitions.
+	const char* PRELUDE =
+		"#include <cmath>\n"
+		"#include <cstdint>\n"
+		"#include <limits>\n"
+		"\n"
+		"extern \"C\"\n"
+		"{\n"
+		"\tstruct thisfunc_symbol\n"
+		"\t{\n"
+		"\t\tconst char* name;\n"
+		"\t\tunsigned arity;\n"
+		"\t\tconst char* source;\n"
+		"\t\tint (*call)(const double* arguments, double* result);\n"
+		"\t};\n"
+		"}\n"
+		"\n"
+		"namespace\n"
+		"{\n"
+		"\tstruct Runtime_Error { };\n"
+		"\tstruct Stack_Overflow { };\n"
+		"\n"
+		"\tconst uintptr_t TF_STACK_BUDGET = 1 << 20;\n"
+		"\tthread_local uintptr_t tf_stack_limit = 0;\n"
+		"\n"
+		"\tinline void tf_check_stack()\n"
+		"\t{\n"
+		"\t\tchar marker;\n"
+		"\t\tif ((uintptr_t)&marker < tf_stack_limit)\n"
+		"\t\t{\n"
+		"\t\t\tthrow Stack_Overflow();\n"
+		"\t\t}\n"
+		"\t}\n"
+		"\n"
+		"\tinline double tf_div(double left, double right)\n"
+		"\t{\n"
+		"\t\tif (right == 0)\n"
+		"\t\t{\n"
+		"\t\t\tthrow Runtime_Error();\n"
+		"\t\t}\n"
+		"\t\treturn left / right;\n"
+		"\t}\n"
+		"\n"
+		"\tinline double tf_eq(double left, double right) { return left == right; }\n"
+		"\tinline double tf_le(double left, double right) { return left < right; }\n"
+		"\tinline double tf_nand(double left, double right) { return !left || !right; }\n";
+
+	std::string name_of(const Node* node)
+	{
+		return dynamic_cast<const Function_Token*>(node->m_token)->m_name;
+	}
+
+	/// The definitions only contain letters, digits and a few symbols but escape them anyway.
+	std::string quote(const std::string& text)
+	{
+		std::string result = "\"";
+
+		for (char c : text)
+		{
+			if (c == '"' || c == '\\')
+			{
+				result += '\\';
+			}
+
+			result += c == '\t' ? ' ' : c;
+		}
+
+		return result + '"';
+	}
+
+	/// Writes the node as a C++ expression.
+	void emit(const Node* node, std::ostream& out)
+	{
+		const Factor_Node* f_ptr = dynamic_cast<const Factor_Node*>(node);
+
+		if (f_ptr)
+		{
+			double value = dynamic_cast<const Number_Token*>(f_ptr->m_token)->m_value;
+
+			// The stream would write inf, nan and -0, which do not read back as those numbers.
+			if (std::isnan(value))
+			{
+				out << "std::numeric_limits<double>::quiet_NaN()";
+			}
+			else if (std::isinf(value))
+			{
+				out << (value < 0 ? "-" : "") << "std::numeric_limits<double>::infinity()";
+			}
+			else if (value == 0 && std::signbit(value))
+			{
+				out << "-0.0";
+			}
+			else
+			{
+				out << "double(" << std::setprecision(17) << value << ')';
+			}
+			return;
+		}
+
+		const Argument_Node* a_ptr = dynamic_cast<const Argument_Node*>(node);
+
+		if (a_ptr)
+		{
+			out << 'a' << dynamic_cast<const Argument_Token*>(a_ptr->m_token)->m_value;
+			return;
+		}
+
+		const Unary_Operation_Node* u_ptr = dynamic_cast<const Unary_Operation_Node*>(node);
+
+		if (u_ptr)
+		{
+			std::string name = name_of(u_ptr);
+
+			out << (name == "sqrt" || name == "sin" || name == "cos" ? "std::" : "tf_") << name << '(';
+			emit(u_ptr->m_argument, out);
+			out << ')';
+			return;
+		}
+
+		const Binary_Operation_Node* b_ptr = dynamic_cast<const Binary_Operation_Node*>(node);
+
+		if (b_ptr)
+		{
+			std::string name = name_of(b_ptr);
+			const char* op = name == "add" ? " + " : name == "sub" ? " - " : name == "mul" ? " * " : nullptr;
+
+			if (op)
+			{
+				out << '(';
+				emit(b_ptr->m_left, out);
+				out << op;
+				emit(b_ptr->m_right, out);
+				out << ')';
+				return;
+			}
+
+			out << (name == "pow" ? "std::" : "tf_") << name << '(';
+			emit(b_ptr->m_left, out);
+			out << ", ";
+			emit(b_ptr->m_right, out);
+			out << ')';
+			return;
+		}
+
+		const If_Opeation_Node* i_ptr = dynamic_cast<const If_Opeation_Node*>(node);
+
+		if (i_ptr)
+		{
+			out << '(';
+			emit(i_ptr->m_check, out);
+			out << " == 0 ? ";
+			emit(i_ptr->m_right, out);
+			out << " : ";
+			emit(i_ptr->m_left, out);
+			out << ')';
+			return;
+		}
+
+		const User_Function* u_f_ptr = dynamic_cast<const User_Function*>(node);
+
+		out << "tf_" << name_of(u_f_ptr) << '(';
+		for (size_t i = 0; i < u_f_ptr->m_arguments.size(); ++i)
+		{
+			out << (i ? ", " : "");
+			emit(u_f_ptr->m_arguments[i], out);
+		}
+		out << ')';
+	}
+
+	void emit_signature(const User_Function* function, std::ostream& out)
+	{
+		out << "\tdouble tf_" << name_of(function) << '(';
+
+		size_t arity = Jit::arity(function->m_definition);
+
+		for (size_t i = 0; i < arity; ++i)
+		{
+			out << (i ? ", " : "") << "double a" << i;
+		}
+
+		out << ')';
+	}
+
+	/// Generates the whole file. Only the functions that fully compile get native code, the rest just keep their source.
+	void generate(const std::vector<const Node*>& functions, const std::vector<std::string>& sources, std::ostream& out)
+	{
+		std::vector<bool> native;
+
+		for (const Node* a : functions)
+		{
+			std::vector<const User_Function*> unused;
+			native.push_back(Jit::collect(dynamic_cast<const User_Function*>(a), functions, unused));
+		}
+
+		out << PRELUDE << '\n';
+
+		for (size_t i = 0; i < functions.size(); ++i)
+		{
+			if (native[i])
+			{
+				emit_signature(dynamic_cast<const User_Function*>(functions[i]), out);
+				out << ";\n";
+			}
+		}
+
+		for (size_t i = 0; i < functions.size(); ++i)
+		{
+			if (native[i])
+			{
+				const User_Function* function = dynamic_cast<const User_Function*>(functions[i]);
+
+				out << '\n';
+				emit_signature(function, out);
+				out << "\n\t{\n\t\ttf_check_stack();\n\t\treturn ";
+				emit(function->m_definition, out);
+				out << ";\n\t}\n";
+			}
+		}
+
+		out << "}\n\nextern \"C\"\n{\n";
+
+		for (size_t i = 0; i < functions.size(); ++i)
+		{
+			if (native[i])
+			{
+				const User_Function* function = dynamic_cast<const User_Function*>(functions[i]);
+
+				// Like the native code of the JIT, the functions get a budget of stack below the entry and give up past it.
+				out << "\tint thisfunc_call_" << name_of(function) << "(const double* arguments, double* result)\n"
+					<< "\t{\n\t\tchar marker;\n\t\ttf_stack_limit = (uintptr_t)&marker - TF_STACK_BUDGET;\n\n"
+					<< "\t\ttry\n\t\t{\n\t\t\t*result = tf_" << name_of(function) << '(';
+
+				for (size_t j = 0; j < Jit::arity(function->m_definition); ++j)
+				{
+					out << (j ? ", " : "") << "arguments[" << j << ']';
+				}
+
+				out << ");\n\t\t\treturn 0;\n\t\t}\n\t\tcatch (const Runtime_Error&)\n\t\t{\n\t\t\treturn 1;\n\t\t}\n"
+					<< "\t\tcatch (const Stack_Overflow&)\n\t\t{\n\t\t\treturn 2;\n\t\t}\n\t}\n\n";
+			}
+		}
+
+		out << "\textern const unsigned thisfunc_abi_version = " << THISFUNC_ABI_VERSION << ";\n"
+			<< "\textern const unsigned thisfunc_symbol_count = " << functions.size() << ";\n"
+			<< "\textern const thisfunc_symbol thisfunc_symbols[] =\n\t{\n";
+
+		for (size_t i = 0; i < functions.size(); ++i)
+		{
+			const User_Function* function = dynamic_cast<const User_Function*>(functions[i]);
+
+			out << "\t\t{ " << quote(name_of(function)) << ", " << Jit::arity(function->m_definition)
+				<< ", " << quote(sources[i]) << ", " << (native[i] ? "&thisfunc_call_" + name_of(function) : "nullptr") << " },\n";
+		}
+
+		out << "\t};\n}\n";
+	}
+
+	/// Runs the program with the arguments and waits for it. Returns whether it exited with 0.
+	/// The arguments are handed over as they are, so quotes or other shell characters in the paths are taken literally.
+	bool run(const std::vector<std::string>& arguments)
+	{
+#ifdef THISFUNC_SPAWN
+		std::vector<char*> argv;
+
+		for (const std::string& a : arguments)
+		{
+			argv.push_back(const_cast<char*>(a.c_str()));
+		}
+
+		argv.push_back(nullptr);
+
+		pid_t child = fork();
+
+		if (child < 0)
+		{
+			return false;
+		}
+
+		if (child == 0)
+		{
+			execvp(argv[0], argv.data());
+			_exit(127);
+		}
+
+		int status;
+
+		while (waitpid(child, &status, 0) < 0)
+		{
+			if (errno != EINTR)
+			{
+				return false;
+			}
+		}
+
+		return WIFEXITED(status) && WEXITSTATUS(status) == 0;
+#else
+		// Without a way to pass the arguments apart, anything the shell would read as more than a word is refused.
+		std::string command;
+
+		for (const std::string& a : arguments)
+		{
+			if (a.find_first_of("\"%^&|<>!`$") != std::string::npos)
+			{
+				return false;
+			}
+
+			command += (command.empty() ? "\"" : " \"") + a + '"';
+		}
+
+		return system(command.c_str()) == 0;
+#endif
+	}
+}
+
+bool compile_library(const std::string& input, const std::string& output, std::ostream& out)
+{
+	std::ifstream in(input);
+
+	if (!in)
+	{
+		Error("File error", "Could not open \"" + input + "\"").print(out);
+		return false;
+	}
+
+	std::vector<const Node*> functions;
+	std::vector<std::string> sources;
+
+	bool ok = true;
+	std::string line;
+
+	while (ok && getline(in, line))
+	{
+		if (line.find_first_not_of(" \t\r") == std::string::npos)
+		{
+			continue;
+		}
+
+		if (line.back() == '\r')
+		{
+			line.pop_back();
+		}
+
+		Node* a = parse(line, out);
+		const User_Function* function = dynamic_cast<const User_Function*>(a);
+
+		if (!function || !function->m_definition)
+		{
+			if (a)
+			{
+				Error("Library error", "Expected a definition: " + line).print(out);
+			}
+
+			delete a;
+			ok = false;
+			break;
+		}
+
+		for (const Node* b : functions)
+		{
+			if (name_of(b) == name_of(function))
+			{
+				Runtime_Error("A function with the same name already exists").print(out);
+				ok = false;
+			}
+		}
+
+		functions.push_back(function);
+		sources.push_back(line);
+	}
+
+	if (ok)
+	{
+		std::string source = output + ".cpp";
+		std::ofstream file(source);
+
+		file << "// Generated by thisfunc from \"" << input << "\".\n\n";
+		generate(functions, sources, file);
+		file.close();
+
+		// CXX may name a launcher before the compiler (like "ccache g++"), so it is split into words.
+		const char* compiler = getenv("CXX");
+		std::istringstream words(compiler ? compiler : "");
+		std::vector<std::string> arguments;
+		std::string word;
+
+		while (words >> word)
+		{
+			arguments.push_back(word);
+		}
+
+		if (arguments.empty())
+		{
+			arguments.push_back("c++");
+		}
+
+		// A path starting with '-' would be read as an option.
+		std::string prefix = output[0] == '-' ? "./" : "";
+
+		// Without contraction into fused multiply-adds the native code rounds like the interpreter.
+		arguments.insert(arguments.end(), { "-O2", "-ffp-contract=off", "-shared", "-fPIC", "-o", prefix + output, prefix + source });
+
+		if (!file || !run(arguments))
+		{
+			Error("Build error", "Could not build \"" + output + "\"").print(out);
+			ok = false;
+		}
+	}
+
+	for (const Node* a : functions)
+	{
+		delete a;
+	}
+
+	return ok;
+}
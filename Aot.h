@@ -0,0 +1,30 @@
+#pragma once
+
+#include "Parser.h"
+
+//#################################################
+// AHEAD-OF-TIME COMPILATION
+//#################################################
+
+/// Every compiled library exports a table of these (thisfunc_symbols, with thisfunc_symbol_count entries)
+/// so that other programs can call the functions through the C ABI without the interpreter.
+extern "C"
+{
+	struct thisfunc_symbol
+	{
+		const char* name;
+		unsigned arity;
+		const char* source; /// The definition as it was written. Used to define the function in the interpreter.
+		int (*call)(const double* arguments, double* result); /// Returns 0 on success, 1 on a runtime error and 2 if it ran out of stack
+															 /// (it uses at most 1 MB below the call). nullptr if the function could not be compiled (e.g. a list).
+	};
+}
+
+/// Bumped whenever the layout of the table changes. Exported as thisfunc_abi_version.
+const unsigned THISFUNC_ABI_VERSION = 1;
+
+/// Reads a file with one definition per line and turns it into a shared object:
+/// generates C++ with one native function per user function, next to the output (with a ".cpp" appended),
+/// and builds it with the system compiler (the CXX environment variable, c++ by default).
+/// The errors are printed to out.
+bool compile_library(const std::string& input, const std::string& output, std::ostream& out);
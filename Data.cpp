@@ -0,0 +1,340 @@
+#include "Data.h"
+#include "Writer.h"
+
+#include <algorithm>
+#include <charconv>
+#include <cstring>
+#include <fstream>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define THISFUNC_MAPPED_DATA
+#endif
+
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+#define THISFUNC_BIG_ENDIAN
+#endif
+
+namespace
+{
+#ifdef THISFUNC_MAPPED_DATA
+	/// A leaf that is a mapped file. The file is unmapped once nobody refers to the list anymore.
+	struct Mapped_List_Value :public List_Value
+	{
+		void* m_memory;
+		size_t m_length; /// In bytes.
+
+		Mapped_List_Value(void* memory, const size_t length)
+			: List_Value((const double*)memory, length / sizeof(double)),
+			m_memory(memory),
+			m_length(length)
+		{ }
+
+		~Mapped_List_Value()
+		{
+			munmap(m_memory, m_length);
+		}
+	};
+#endif
+
+#ifdef THISFUNC_BIG_ENDIAN
+	/// Turns little endian doubles into those of the host and back.
+	void swap_bytes(double* values, size_t count)
+	{
+		for (size_t i = 0; i < count; ++i)
+		{
+			unsigned char* bytes = (unsigned char*)(values + i);
+			std::reverse(bytes, bytes + sizeof(double));
+		}
+	}
+#endif
+
+	bool is_blank(const char c)
+	{
+		return c == ' ' || c == '\t' || c == '\r';
+	}
+
+	/// Converts the field of the line (which ends at last) in the column. Returns false if there is no number there.
+	bool parse_field(const char* first, const char* last, size_t column, double& value)
+	{
+		for (size_t i = 0; i < column; ++i)
+		{
+			first = (const char*)memchr(first, ',', last - first);
+
+			if (!first)
+			{
+				return false;
+			}
+
+			++first;
+		}
+
+		const char* end = (const char*)memchr(first, ',', last - first);
+
+		if (!end)
+		{
+			end = last;
+		}
+
+		while (first < end && is_blank(*first))
+		{
+			++first;
+		}
+
+		while (end > first && is_blank(end[-1]))
+		{
+			--end;
+		}
+
+		if (end - first >= 2 && *first == '"' && end[-1] == '"')
+		{
+			++first;
+			--end;
+		}
+
+		// from_chars takes no plus sign.
+		if (first < end && *first == '+')
+		{
+			++first;
+		}
+
+		std::from_chars_result result = std::from_chars(first, end, value);
+
+		return first < end && result.ec == std::errc() && result.ptr == end;
+	}
+}
+
+List_Value* load_doubles(const std::string& path, std::string& error)
+{
+#if defined(THISFUNC_MAPPED_DATA) && !defined(THISFUNC_BIG_ENDIAN)
+	int file = open(path.c_str(), O_RDONLY);
+
+	if (file < 0)
+	{
+		error = "\"" + path + "\" cannot be opened";
+		return nullptr;
+	}
+
+	struct stat status;
+
+	if (fstat(file, &status) != 0 || !S_ISREG(status.st_mode) || status.st_size % sizeof(double) != 0)
+	{
+		close(file);
+		error = "\"" + path + "\" is not a file of doubles";
+		return nullptr;
+	}
+
+	// There is nothing to map.
+	if (status.st_size == 0)
+	{
+		close(file);
+		return new List_Value(std::vector<double>());
+	}
+
+	void* memory = mmap(nullptr, status.st_size, PROT_READ, MAP_PRIVATE, file, 0);
+
+	close(file); // The mapping keeps the file.
+
+	if (memory == MAP_FAILED)
+	{
+		error = "\"" + path + "\" cannot be mapped";
+		return nullptr;
+	}
+
+	return new Mapped_List_Value(memory, status.st_size);
+#else
+	std::ifstream in(path, std::ios::binary | std::ios::ate);
+
+	if (!in)
+	{
+		error = "\"" + path + "\" cannot be opened";
+		return nullptr;
+	}
+
+	std::streamoff length = in.tellg();
+
+	if (length < 0 || length % sizeof(double) != 0)
+	{
+		error = "\"" + path + "\" is not a file of doubles";
+		return nullptr;
+	}
+
+	std::vector<double> elements(length / sizeof(double));
+
+	in.seekg(0);
+
+	if (!in.read((char*)elements.data(), length))
+	{
+		error = "\"" + path + "\" cannot be read";
+		return nullptr;
+	}
+
+#ifdef THISFUNC_BIG_ENDIAN
+	swap_bytes(elements.data(), elements.size());
+#endif
+	return new List_Value(std::move(elements));
+#endif
+}
+
+bool load_csv(const std::string& path, size_t column, std::vector<double>& elements, std::string& error)
+{
+	const size_t CHUNK_SIZE = 1 << 16;
+
+	std::ifstream in(path, std::ios::binary);
+
+	if (!in)
+	{
+		error = "\"" + path + "\" cannot be opened";
+		return false;
+	}
+
+	std::vector<char> buffer(CHUNK_SIZE);
+	size_t kept = 0; // The beginning of a line that the last chunk cut off.
+	size_t line = 0;
+	bool first_line = true;
+	bool more = true;
+
+	while (more)
+	{
+		// A line longer than the buffer makes it grow.
+		if (kept == buffer.size())
+		{
+			buffer.resize(buffer.size() * 2);
+		}
+
+		in.read(buffer.data() + kept, buffer.size() - kept);
+		more = in.gcount() > 0;
+
+		const char* first = buffer.data();
+		const char* end = first + kept + in.gcount();
+
+		while (first < end)
+		{
+			const char* last = (const char*)memchr(first, '\n', end - first);
+
+			// The last line of the file may have no end of line.
+			if (!last)
+			{
+				if (more)
+				{
+					break;
+				}
+
+				last = end;
+			}
+
+			++line;
+
+			const char* c = first;
+
+			while (c < last && is_blank(*c))
+			{
+				++c;
+			}
+
+			double value;
+
+			if (c == last)
+			{
+				// Empty lines are skipped.
+			}
+			else if (parse_field(first, last, column, value))
+			{
+				elements.push_back(value);
+				first_line = false;
+			}
+			else if (first_line)
+			{
+				first_line = false; // The header.
+			}
+			else
+			{
+				error = "Expected a number in column " + std::to_string(column) + " of line " + std::to_string(line) + " of \"" + path + "\"";
+				return false;
+			}
+
+			first = last == end ? end : last + 1;
+		}
+
+		kept = end - first;
+		memmove(buffer.data(), first, kept);
+	}
+
+	if (in.bad())
+	{
+		error = "\"" + path + "\" cannot be read";
+		return false;
+	}
+
+	return true;
+}
+
+bool save_doubles(const std::string& path, const Value& list, std::string& error)
+{
+	std::ofstream out(path, std::ios::binary | std::ios::trunc);
+
+	if (!out)
+	{
+		error = "\"" + path + "\" cannot be written";
+		return false;
+	}
+
+	list.for_each_chunk([&out](const double* elements, size_t count)
+	{
+#ifdef THISFUNC_BIG_ENDIAN
+		std::vector<double> swapped(elements, elements + count);
+		swap_bytes(swapped.data(), count);
+		elements = swapped.data();
+#endif
+		return (bool)out.write((const char*)elements, count * sizeof(double));
+	});
+
+	out.close();
+
+	if (!out)
+	{
+		error = "\"" + path + "\" cannot be written";
+		return false;
+	}
+
+	return true;
+}
+
+bool save_csv(const std::string& path, const Value& list, std::string& error)
+{
+	std::ofstream out(path, std::ios::binary | std::ios::trunc);
+	Writer writer;
+
+	if (!out)
+	{
+		error = "\"" + path + "\" cannot be written";
+		return false;
+	}
+
+	writer.open(out);
+
+	list.for_each_chunk([&writer](const double* elements, size_t count)
+	{
+		for (size_t i = 0; i < count; ++i)
+		{
+			writer.write(elements[i]);
+			writer.write('\n');
+		}
+
+		return true;
+	});
+
+	writer.flush();
+	out.close();
+
+	if (!out)
+	{
+		error = "\"" + path + "\" cannot be written";
+		return false;
+	}
+
+	return true;
+}
\ No newline at end of file
@@ -0,0 +1,26 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <vector>
+#include "Value.h"
+
+//#################################################
+// DATA FILES
+//#################################################
+
+/// Lists in and out of files, for data too big to be typed in as list(...).
+/// Every function returns false (or nullptr) with the reason in error if it cannot do its job.
+
+/// A file of raw little endian doubles as a list. Where the host has mmap and is little endian, the list is the mapped file
+/// itself, so nothing is read or copied until the elements are used. The file should not change while the list lives.
+List_Value* load_doubles(const std::string& path, std::string& error);
+
+/// The numbers in a column (counted from 0) of a CSV file, read a chunk at a time. A first line without a number there
+/// is taken for a header and skipped, and so are empty lines. The fields may be in quotes (with no commas inside) and have spaces around them.
+bool load_csv(const std::string& path, size_t column, std::vector<double>& elements, std::string& error);
+
+/// Write the list as raw little endian doubles (which load_doubles reads back) and as a CSV file of one column.
+/// The CSV file has the shortest text that reads back as the same double for every element.
+bool save_doubles(const std::string& path, const Value& list, std::string& error);
+bool save_csv(const std::string& path, const Value& list, std::string& error);
\ No newline at end of file
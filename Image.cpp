@@ -0,0 +1,549 @@
+#include "Image.h"
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define THISFUNC_MAPPED_IMAGE
+#endif
+
+namespace
+{
+	const uint64_t MAGIC = 0x47414D4943465354; /// "TSFCIMAG"
+	const uint64_t ORDER_MARK = 0x0102030405060708; /// Reads differently on a machine with the other byte order.
+	const size_t MAX_DEPTH = 4096; /// How deep a tree may be. Deeper ones are refused rather than run out of stack (even with sanitizers).
+
+	struct Header
+	{
+		uint64_t m_magic;
+		uint64_t m_byte_order;
+		uint32_t m_version;
+		uint32_t m_functions; /// How many definitions the records make, one after the other.
+		uint64_t m_records;
+		uint64_t m_text_size; /// The names and texts follow the records.
+		uint64_t m_checksum; /// Of everything after the header.
+	};
+
+	/// Which node a record stands for.
+	enum class Kind :uint32_t
+	{
+		NONE, /// A missing child, such as the initial value of reduce.
+		FACTOR,
+		ARGUMENT,
+		UNARY,
+		BINARY,
+		IF,
+		LIST,
+		MAP,
+		REDUCE,
+		FILTER,
+		ZIP,
+		USER,
+	};
+
+	/// Which token the node has.
+	enum class Token_Kind :uint32_t
+	{
+		NONE,
+		FUNCTION,
+		NUMBER,
+		ARGUMENT,
+		TEXT,
+		OTHER, /// A token with nothing but its type.
+		INTEGER, /// A number that was written as an integer. Its value is the int64 itself.
+	};
+
+	/// A node. Its children follow it, each one with its own children right after it (i.e. in preorder).
+	struct Record
+	{
+		Kind m_kind;
+		uint32_t m_children;
+		Token_Kind m_token;
+		uint32_t m_length; /// Of the name or the text.
+		uint64_t m_value; /// The bits of a number (or of an integer), the index of an argument, where a name or a text starts, or the type of another token.
+	};
+
+	/// FNV-1a.
+	uint64_t checksum(const char* data, size_t size, uint64_t hash = 0xCBF29CE484222325)
+	{
+		for (size_t i = 0; i < size; ++i)
+		{
+			hash = (hash ^ (unsigned char)data[i]) * 0x100000001B3;
+		}
+
+		return hash;
+	}
+
+	/// Appends the records of the node (depth levels down its tree) and of its children.
+	/// Returns false for a node that the parser does not make or a tree deeper than MAX_DEPTH.
+	bool flatten(const Node* node, std::vector<Record>& records, std::string& text, size_t depth)
+	{
+		Record record = { Kind::NONE, 0, Token_Kind::NONE, 0, 0 };
+		std::vector<const Node*> children;
+
+		if (depth > MAX_DEPTH)
+		{
+			return false;
+		}
+
+		if (!node)
+		{
+			records.push_back(record);
+			return true;
+		}
+
+		if (dynamic_cast<const Factor_Node*>(node))
+		{
+			record.m_kind = Kind::FACTOR;
+		}
+		else if (dynamic_cast<const Argument_Node*>(node))
+		{
+			record.m_kind = Kind::ARGUMENT;
+		}
+		else if (const Unary_Operation_Node* u_ptr = dynamic_cast<const Unary_Operation_Node*>(node))
+		{
+			record.m_kind = Kind::UNARY;
+			children = { u_ptr->m_argument };
+		}
+		else if (const Binary_Operation_Node* b_ptr = dynamic_cast<const Binary_Operation_Node*>(node))
+		{
+			record.m_kind = Kind::BINARY;
+			children = { b_ptr->m_left, b_ptr->m_right };
+		}
+		else if (const If_Opeation_Node* i_ptr = dynamic_cast<const If_Opeation_Node*>(node))
+		{
+			record.m_kind = Kind::IF;
+			children = { i_ptr->m_check, i_ptr->m_left, i_ptr->m_right };
+		}
+		else if (const List_Operation_Node* l_ptr = dynamic_cast<const List_Operation_Node*>(node))
+		{
+			record.m_kind = Kind::LIST;
+			children.assign(l_ptr->m_contents.begin(), l_ptr->m_contents.end());
+		}
+		else if (const Map_Operation_Node* m_ptr = dynamic_cast<const Map_Operation_Node*>(node))
+		{
+			record.m_kind = Kind::MAP;
+			children = { m_ptr->m_functor, m_ptr->m_list };
+		}
+		else if (const Reduce_Operation_Node* r_ptr = dynamic_cast<const Reduce_Operation_Node*>(node))
+		{
+			record.m_kind = Kind::REDUCE;
+			children = { r_ptr->m_functor, r_ptr->m_initial, r_ptr->m_list };
+		}
+		else if (const Filter_Operation_Node* f_ptr = dynamic_cast<const Filter_Operation_Node*>(node))
+		{
+			record.m_kind = Kind::FILTER;
+			children = { f_ptr->m_functor, f_ptr->m_list };
+		}
+		else if (const Zip_Operation_Node* z_ptr = dynamic_cast<const Zip_Operation_Node*>(node))
+		{
+			record.m_kind = Kind::ZIP;
+			children = { z_ptr->m_functor, z_ptr->m_left, z_ptr->m_right };
+		}
+		else if (const User_Function* u_f_ptr = dynamic_cast<const User_Function*>(node))
+		{
+			record.m_kind = Kind::USER;
+			children = { u_f_ptr->m_definition };
+			children.insert(children.end(), u_f_ptr->m_arguments.begin(), u_f_ptr->m_arguments.end());
+		}
+		else
+		{
+			return false;
+		}
+
+		if (const Function_Token* f_token = dynamic_cast<const Function_Token*>(node->m_token))
+		{
+			record.m_token = Token_Kind::FUNCTION;
+			record.m_value = text.size();
+			record.m_length = f_token->m_name.size();
+			text += f_token->m_name;
+		}
+		else if (const Number_Token* n_token = dynamic_cast<const Number_Token*>(node->m_token))
+		{
+			record.m_token = n_token->m_is_integer ? Token_Kind::INTEGER : Token_Kind::NUMBER;
+
+			if (n_token->m_is_integer)
+			{
+				memcpy(&record.m_value, &n_token->m_integer, sizeof(record.m_value));
+			}
+			else
+			{
+				memcpy(&record.m_value, &n_token->m_value, sizeof(record.m_value));
+			}
+		}
+		else if (const Argument_Token* a_token = dynamic_cast<const Argument_Token*>(node->m_token))
+		{
+			record.m_token = Token_Kind::ARGUMENT;
+			record.m_value = a_token->m_value;
+		}
+		else if (const Text_Token* t_token = dynamic_cast<const Text_Token*>(node->m_token))
+		{
+			record.m_token = Token_Kind::TEXT;
+			record.m_value = text.size();
+			record.m_length = t_token->m_text.size();
+			text += t_token->m_text;
+		}
+		else if (node->m_token)
+		{
+			record.m_token = Token_Kind::OTHER;
+			record.m_value = (uint64_t)node->m_token->m_type;
+		}
+
+		record.m_children = children.size();
+		records.push_back(record);
+
+		for (const Node* a : children)
+		{
+			if (!flatten(a, records, text, depth + 1))
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	/// The token of the record. nullptr if it has none or it does not make sense.
+	Token* token_of(const Record& record, const char* text, size_t text_size)
+	{
+		bool named = record.m_token == Token_Kind::FUNCTION || record.m_token == Token_Kind::TEXT;
+
+		if (named && (record.m_value > text_size || record.m_length > text_size - record.m_value))
+		{
+			return nullptr;
+		}
+
+		switch (record.m_token)
+		{
+		case Token_Kind::FUNCTION:
+		{
+			return new Function_Token(std::string(text + record.m_value, record.m_length));
+		}
+		case Token_Kind::NUMBER:
+		{
+			double value;
+			memcpy(&value, &record.m_value, sizeof(value));
+			return new Number_Token(value);
+		}
+		case Token_Kind::INTEGER:
+		{
+			int64_t integer;
+			memcpy(&integer, &record.m_value, sizeof(integer));
+			return new Number_Token(integer);
+		}
+		case Token_Kind::ARGUMENT:
+		{
+			return record.m_value <= UINT32_MAX ? new Argument_Token((unsigned)record.m_value) : nullptr;
+		}
+		case Token_Kind::TEXT:
+		{
+			return new Text_Token(std::string(text + record.m_value, record.m_length));
+		}
+		case Token_Kind::OTHER:
+		{
+			return record.m_value <= (uint64_t)Type::TEXT ? new Token((Type)record.m_value) : nullptr;
+		}
+		default:
+			return nullptr;
+		}
+	}
+
+	/// Makes the node of the record at index (depth levels down its tree) and those of its children, and moves index past all of them.
+	/// Returns false (and makes nothing) if the records do not make a tree that the parser could have made or one deeper than MAX_DEPTH.
+	bool build(const Record* records, size_t count, const char* text, size_t text_size, size_t& index, Node*& node, size_t depth)
+	{
+		node = nullptr;
+
+		if (index >= count || depth > MAX_DEPTH)
+		{
+			return false;
+		}
+
+		const Record& record = records[index++];
+
+		if (record.m_kind == Kind::NONE)
+		{
+			return record.m_children == 0 && record.m_token == Token_Kind::NONE;
+		}
+
+		size_t expected = record.m_kind == Kind::FACTOR || record.m_kind == Kind::ARGUMENT ? 0
+			: record.m_kind == Kind::UNARY ? 1
+			: record.m_kind == Kind::BINARY || record.m_kind == Kind::MAP || record.m_kind == Kind::FILTER ? 2
+			: record.m_kind == Kind::IF || record.m_kind == Kind::REDUCE || record.m_kind == Kind::ZIP ? 3
+			: record.m_children; // Lists and calls have as many as they have.
+
+		Token* token = token_of(record, text, text_size);
+		bool ok = token && record.m_children == expected && record.m_kind <= Kind::USER
+			&& (expected == 0 || record.m_token == Token_Kind::FUNCTION) && (record.m_kind != Kind::USER || expected > 0);
+
+		// Every child has at least a record of its own, so there are never more of them than records left.
+		ok = ok && record.m_children <= count - index;
+
+		std::vector<Node*> children;
+
+		for (uint32_t i = 0; ok && i < record.m_children; ++i)
+		{
+			Node* child;
+
+			ok = build(records, count, text, text_size, index, child, depth + 1);
+
+			if (ok)
+			{
+				children.push_back(child);
+			}
+		}
+
+		if (!ok)
+		{
+			for (Node* a : children)
+			{
+				delete a;
+			}
+
+			delete token;
+			return false;
+		}
+
+		// The nodes copy the token and take over their children.
+		switch (record.m_kind)
+		{
+		case Kind::FACTOR:
+		{
+			node = new Factor_Node(token);
+			break;
+		}
+		case Kind::ARGUMENT:
+		{
+			node = new Argument_Node(token);
+			break;
+		}
+		case Kind::UNARY:
+		{
+			node = new Unary_Operation_Node(token, children[0]);
+			break;
+		}
+		case Kind::BINARY:
+		{
+			node = new Binary_Operation_Node(token, children[0], children[1]);
+			break;
+		}
+		case Kind::IF:
+		{
+			node = new If_Opeation_Node(token, children[0], children[1], children[2]);
+			break;
+		}
+		case Kind::LIST:
+		{
+			node = new List_Operation_Node(token, children);
+			break;
+		}
+		case Kind::MAP:
+		{
+			node = new Map_Operation_Node(token, children[0], children[1]);
+			break;
+		}
+		case Kind::REDUCE:
+		{
+			node = new Reduce_Operation_Node(token, children[0], children[1], children[2]);
+			break;
+		}
+		case Kind::FILTER:
+		{
+			node = new Filter_Operation_Node(token, children[0], children[1]);
+			break;
+		}
+		case Kind::ZIP:
+		{
+			node = new Zip_Operation_Node(token, children[0], children[1], children[2]);
+			break;
+		}
+		default: // The only one left is a call or a definition.
+			node = new User_Function(token, children[0], std::vector<const Node*>(children.begin() + 1, children.end()));
+		}
+
+		delete token;
+		return true;
+	}
+
+	/// Checks the image and makes its definitions. The error is left in error.
+	bool rebuild(const char* data, size_t size, const std::string& path, std::vector<Node*>& functions, std::string& error)
+	{
+		Header header;
+
+		if (size < sizeof(Header))
+		{
+			error = "\"" + path + "\" is not an image";
+			return false;
+		}
+
+		memcpy(&header, data, sizeof(header));
+
+		if (header.m_magic != MAGIC)
+		{
+			error = "\"" + path + "\" is not an image";
+			return false;
+		}
+
+		if (header.m_byte_order != ORDER_MARK)
+		{
+			error = "\"" + path + "\" was made on a machine with another byte order";
+			return false;
+		}
+
+		if (header.m_version != THISFUNC_IMAGE_VERSION)
+		{
+			error = "\"" + path + "\" is an image of version " + std::to_string(header.m_version) + " instead of " + std::to_string(THISFUNC_IMAGE_VERSION);
+			return false;
+		}
+
+		size_t rest = size - sizeof(Header);
+
+		if (header.m_records > rest / sizeof(Record) || header.m_text_size != rest - header.m_records * sizeof(Record)
+			|| checksum(data + sizeof(Header), rest) != header.m_checksum)
+		{
+			error = "\"" + path + "\" is damaged";
+			return false;
+		}
+
+		const Record* records = (const Record*)(data + sizeof(Header));
+		const char* text = data + sizeof(Header) + header.m_records * sizeof(Record);
+		size_t index = 0;
+		std::vector<Node*> made;
+		bool ok = true;
+
+		for (uint32_t i = 0; ok && i < header.m_functions; ++i)
+		{
+			Node* node;
+			ok = build(records, header.m_records, text, header.m_text_size, index, node, 0);
+
+			if (ok)
+			{
+				made.push_back(node);
+
+				const User_Function* function = dynamic_cast<const User_Function*>(node);
+				ok = function && function->m_definition;
+			}
+		}
+
+		if (!ok || index != header.m_records)
+		{
+			for (Node* a : made)
+			{
+				delete a;
+			}
+
+			error = "\"" + path + "\" is damaged";
+			return false;
+		}
+
+		functions.insert(functions.end(), made.begin(), made.end());
+		return true;
+	}
+}
+
+bool write_image(const std::vector<const Node*>& functions, const std::string& path, std::ostream& out)
+{
+	std::vector<Record> records;
+	std::string text;
+
+	for (const Node* a : functions)
+	{
+		if (!flatten(a, records, text, 0))
+		{
+			Error("Image error", "A definition cannot be written to an image").print(out);
+			return false;
+		}
+	}
+
+	Header header = { MAGIC, ORDER_MARK, THISFUNC_IMAGE_VERSION, (uint32_t)functions.size(), records.size(), text.size(), 0 };
+
+	header.m_checksum = checksum(text.data(), text.size(), checksum((const char*)records.data(), records.size() * sizeof(Record)));
+
+	// The image is made on the side and moved into place, so that a process starting meanwhile never maps half of one.
+	std::string temporary = path + ".part";
+	std::ofstream file(temporary, std::ios::binary | std::ios::trunc);
+
+	file.write((const char*)&header, sizeof(header));
+	file.write((const char*)records.data(), records.size() * sizeof(Record));
+	file.write(text.data(), text.size());
+	file.close();
+
+	if (!file || std::rename(temporary.c_str(), path.c_str()) != 0)
+	{
+		std::remove(temporary.c_str());
+		Error("Image error", "\"" + path + "\" cannot be written").print(out);
+		return false;
+	}
+
+	return true;
+}
+
+bool read_image(const std::string& path, std::vector<Node*>& functions, std::ostream& out)
+{
+	std::string error;
+	bool ok;
+
+#ifdef THISFUNC_MAPPED_IMAGE
+	int file = open(path.c_str(), O_RDONLY);
+	struct stat status;
+
+	if (file < 0 || fstat(file, &status) != 0 || !S_ISREG(status.st_mode))
+	{
+		if (file >= 0)
+		{
+			close(file);
+		}
+
+		Error("Image error", "\"" + path + "\" cannot be opened").print(out);
+		return false;
+	}
+
+	// An empty file cannot be mapped, and it is not an image either.
+	void* memory = status.st_size > 0 ? mmap(nullptr, status.st_size, PROT_READ, MAP_PRIVATE, file, 0) : MAP_FAILED;
+
+	close(file); // The mapping keeps the file.
+
+	if (memory == MAP_FAILED)
+	{
+		Error("Image error", "\"" + path + "\" is not an image").print(out);
+		return false;
+	}
+
+	ok = rebuild((const char*)memory, status.st_size, path, functions, error);
+
+	munmap(memory, status.st_size);
+#else
+	std::ifstream file(path, std::ios::binary | std::ios::ate);
+
+	if (!file)
+	{
+		Error("Image error", "\"" + path + "\" cannot be opened").print(out);
+		return false;
+	}
+
+	std::streamoff size = file.tellg();
+	std::vector<uint64_t> data(size / sizeof(uint64_t) + 1); // Aligned for the records.
+
+	file.seekg(0);
+	file.read((char*)data.data(), size);
+
+	ok = file && rebuild((const char*)data.data(), size, path, functions, error);
+
+	if (!file)
+	{
+		error = "\"" + path + "\" cannot be read";
+	}
+#endif
+
+	if (!ok)
+	{
+		Error("Image error", error).print(out);
+	}
+
+	return ok;
+}
\ No newline at end of file
@@ -0,0 +1,23 @@
+#pragma once
+
+#include <cstdint>
+#include "Parser.h"
+
+//#################################################
+// IMAGES
+//#################################################
+
+/// An image is a snapshot of the definitions of an interpreter: their syntax trees flattened into one file,
+/// which a new process maps and turns back into nodes without going through the lexer and the parser.
+/// The nodes refer to their children and their names by position, never by address, so the file can be mapped anywhere.
+/// A header with a checksum of the rest comes first, so that a file that was cut short or changed is never used.
+
+/// Bumped whenever the layout of the image changes. Images of other versions are refused.
+const uint32_t THISFUNC_IMAGE_VERSION = 1;
+
+/// Writes the definitions (User_Function nodes) to the file, in order. The errors are printed to out.
+bool write_image(const std::vector<const Node*>& functions, const std::string& path, std::ostream& out);
+
+/// Makes the definitions of the image again, in the order they were written, and appends them to functions.
+/// Makes none of them if the image is not valid. The errors are printed to out.
+bool read_image(const std::string& path, std::vector<Node*>& functions, std::ostream& out);
\ No newline at end of file
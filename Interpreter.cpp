@@ -1,5 +1,301 @@
 #include "Interpreter.h"
 
+#include <sstream>
+#include <unordered_set>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <dlfcn.h>
+#define THISFUNC_LIBRARIES
+#endif
+
+namespace
+{
+	/// Combines the elements in a tree rather than from left to right: eight running results side by side
+	/// (which the compiler can vectorize), combined pairwise at the end. This also keeps the rounding errors small.
+	template<class F>
+	double tree(const double* elements, size_t count, double identity, F combine)
+	{
+		const size_t LANES = 8;
+		double lanes[LANES];
+
+		std::fill(lanes, lanes + LANES, identity);
+
+		size_t i = 0;
+
+		for (; i + LANES <= count; i += LANES)
+		{
+			for (size_t j = 0; j < LANES; ++j)
+			{
+				lanes[j] = combine(lanes[j], elements[i + j]);
+			}
+		}
+
+		for (; i < count; ++i)
+		{
+			lanes[i % LANES] = combine(lanes[i % LANES], elements[i]);
+		}
+
+		for (size_t width = LANES / 2; width > 0; width /= 2)
+		{
+			for (size_t j = 0; j < width; ++j)
+			{
+				lanes[j] = combine(lanes[j], lanes[j + width]);
+			}
+		}
+
+		return lanes[0];
+	}
+
+	/// Neumaier's version of Kahan's summation: the compensation collects the low bits that every addition rounds off.
+	void compensated(const double* elements, size_t count, double& sum, double& compensation)
+	{
+		sum = 0;
+		compensation = 0;
+
+		for (size_t i = 0; i < count; ++i)
+		{
+			double t = sum + elements[i];
+
+			if (std::fabs(sum) >= std::fabs(elements[i]))
+			{
+				compensation += (sum - t) + elements[i];
+			}
+			else
+			{
+				compensation += (elements[i] - t) + sum;
+			}
+
+			sum = t;
+		}
+	}
+
+	/// Orders the NaNs after all the numbers, so that sorting a list with them is still well defined.
+	bool less(double a, double b)
+	{
+		return !std::isnan(a) && (std::isnan(b) || a < b);
+	}
+
+	/// axpy is the only builtin with three arguments, so it gets parsed as a call.
+	bool is_axpy(const User_Function* node)
+	{
+		return !node->m_definition && dynamic_cast<const Function_Token*>(node->m_token)->m_name == "axpy" && node->m_arguments.size() == 3;
+	}
+
+	/// What a chain of maps with user functions goes over: the list of the innermost one, unless that one is mapped
+	/// with a builtin. A builtin goes over the whole list at once, so that map gets evaluated on its own.
+	const Node* source_of(const Map_Operation_Node* node)
+	{
+		const Node* source = node->m_list;
+
+		for (const Map_Operation_Node* m_ptr = dynamic_cast<const Map_Operation_Node*>(source); m_ptr; m_ptr = dynamic_cast<const Map_Operation_Node*>(source))
+		{
+			const Function_Token* f_name = dynamic_cast<const Function_Token*>(m_ptr->m_functor->m_token);
+
+			if (!f_name || is_unary_builtin(f_name->m_name))
+			{
+				break;
+			}
+
+			source = m_ptr->m_list;
+		}
+
+		return source;
+	}
+
+	/// How many times the node calls the function of that name (not counting map and the like).
+	size_t calls_to(const Node* node, const std::string& name)
+	{
+		const Unary_Operation_Node* u_ptr = dynamic_cast<const Unary_Operation_Node*>(node);
+
+		if (u_ptr)
+		{
+			return (dynamic_cast<const Function_Token*>(u_ptr->m_token)->m_name == name) + calls_to(u_ptr->m_argument, name);
+		}
+
+		const Binary_Operation_Node* b_ptr = dynamic_cast<const Binary_Operation_Node*>(node);
+
+		if (b_ptr)
+		{
+			return (dynamic_cast<const Function_Token*>(b_ptr->m_token)->m_name == name) + calls_to(b_ptr->m_left, name) + calls_to(b_ptr->m_right, name);
+		}
+
+		const If_Opeation_Node* i_ptr = dynamic_cast<const If_Opeation_Node*>(node);
+
+		if (i_ptr)
+		{
+			return calls_to(i_ptr->m_check, name) + calls_to(i_ptr->m_left, name) + calls_to(i_ptr->m_right, name);
+		}
+
+		const User_Function* u_f_ptr = dynamic_cast<const User_Function*>(node);
+		size_t calls = 0;
+
+		if (u_f_ptr)
+		{
+			calls = dynamic_cast<const Function_Token*>(u_f_ptr->m_token)->m_name == name;
+
+			for (const Node* a : u_f_ptr->m_arguments)
+			{
+				calls += calls_to(a, name);
+			}
+		}
+
+		return calls;
+	}
+
+	/// Appends the node, token by token and with numbers bit by bit, to text, and the names of the functions it refers to to names.
+	void describe(const Node* node, std::string& text, std::vector<std::string>& names)
+	{
+		if (!node)
+		{
+			text += '-';
+			return;
+		}
+
+		const Function_Token* f_token = dynamic_cast<const Function_Token*>(node->m_token);
+		const Number_Token* n_token = dynamic_cast<const Number_Token*>(node->m_token);
+		const Argument_Token* a_token = dynamic_cast<const Argument_Token*>(node->m_token);
+		const Text_Token* t_token = dynamic_cast<const Text_Token*>(node->m_token);
+
+		if (f_token)
+		{
+			text += f_token->m_name;
+			names.push_back(f_token->m_name);
+		}
+		else if (n_token)
+		{
+			text.append((const char*)&n_token->m_value, sizeof(n_token->m_value));
+
+			// Two integers beyond 2^53 may have the same double.
+			if (n_token->m_is_integer)
+			{
+				text.append((const char*)&n_token->m_integer, sizeof(n_token->m_integer));
+			}
+		}
+		else if (a_token)
+		{
+			text += '#';
+			text.append((const char*)&a_token->m_value, sizeof(a_token->m_value));
+		}
+		else if (t_token)
+		{
+			text += '"' + t_token->m_text + '"';
+		}
+
+		std::vector<const Node*> children;
+
+		if (const Unary_Operation_Node* u_ptr = dynamic_cast<const Unary_Operation_Node*>(node))
+		{
+			children = { u_ptr->m_argument };
+		}
+		else if (const Binary_Operation_Node* b_ptr = dynamic_cast<const Binary_Operation_Node*>(node))
+		{
+			children = { b_ptr->m_left, b_ptr->m_right };
+		}
+		else if (const If_Opeation_Node* i_ptr = dynamic_cast<const If_Opeation_Node*>(node))
+		{
+			children = { i_ptr->m_check, i_ptr->m_left, i_ptr->m_right };
+		}
+		else if (const User_Function* u_f_ptr = dynamic_cast<const User_Function*>(node))
+		{
+			children.assign(u_f_ptr->m_arguments.begin(), u_f_ptr->m_arguments.end());
+		}
+		else if (const List_Operation_Node* l_ptr = dynamic_cast<const List_Operation_Node*>(node))
+		{
+			children.assign(l_ptr->m_contents.begin(), l_ptr->m_contents.end());
+		}
+		else if (const Map_Operation_Node* m_ptr = dynamic_cast<const Map_Operation_Node*>(node))
+		{
+			children = { m_ptr->m_functor, m_ptr->m_list };
+		}
+		else if (const Reduce_Operation_Node* r_ptr = dynamic_cast<const Reduce_Operation_Node*>(node))
+		{
+			children = { r_ptr->m_functor, r_ptr->m_initial, r_ptr->m_list };
+		}
+		else if (const Filter_Operation_Node* f_ptr = dynamic_cast<const Filter_Operation_Node*>(node))
+		{
+			children = { f_ptr->m_functor, f_ptr->m_list };
+		}
+		else if (const Zip_Operation_Node* z_ptr = dynamic_cast<const Zip_Operation_Node*>(node))
+		{
+			children = { z_ptr->m_functor, z_ptr->m_left, z_ptr->m_right };
+		}
+
+		// The brackets keep apart trees that have the same tokens in the same order.
+		text += '(';
+
+		for (const Node* a : children)
+		{
+			describe(a, text, names);
+		}
+
+		text += ')';
+	}
+
+	/// The elements of the list in one piece: its own if it has a single chunk of doubles, otherwise a copy in buffer.
+	const double* packed(const Value& list, std::vector<double>& buffer)
+	{
+		const double* elements = nullptr;
+
+		// The chunks of floats are only widened for the time of the call.
+		list.for_each_chunk([&elements, &list](const double* chunk, size_t count)
+		{
+			elements = count == list.size() && !list.is_single() ? chunk : nullptr;
+			return false;
+		});
+
+		if (!elements)
+		{
+			buffer = list.elements();
+			elements = buffer.data();
+		}
+
+		return elements;
+	}
+
+	/// Copies the elements of the list to elements, as T. Those of a single list go as the floats they are.
+	template<class T>
+	void copy_elements(const Value& list, T* elements)
+	{
+		auto copy = [&elements](const auto* chunk, size_t count)
+		{
+			elements = std::copy(chunk, chunk + count, elements);
+			return true;
+		};
+
+		if (list.is_single())
+		{
+			list.for_each_float_chunk(copy);
+		}
+		else
+		{
+			list.for_each_chunk(copy);
+		}
+	}
+
+	/// The number as the arithmetic of T takes it.
+	template<class T>
+	T number_of(const Value& value)
+	{
+		return (T)value.number();
+	}
+
+	template<>
+	int64_t number_of<int64_t>(const Value& value)
+	{
+		return value.integer();
+	}
+
+	Value value_of(const double number)
+	{
+		return Value(number);
+	}
+
+	Value value_of(const int64_t integer)
+	{
+		return Value(integer);
+	}
+}
+
 bool Interpreter::visit(const Node* ast, std::ostream& out)
 {
 	const Factor_Node* f_ptr = dynamic_cast<const Factor_Node*>(ast);
@@ -20,6 +316,19 @@ bool Interpreter::visit(const Node* ast, std::ostream& out)
 
 	if (u_ptr)
 	{
+		const std::string& name = dynamic_cast<const Function_Token*>(u_ptr->m_token)->m_name;
+
+		if (name == "load")
+		{
+			return visit_file_function(u_ptr, out);
+		}
+
+		// In lazy mode a user function gets its argument as a thunk.
+		if (m_lazy && !is_unary_builtin(name) && !is_list_builtin(name))
+		{
+			return delay(u_ptr->m_argument, out) && call_user(name, 1, out);
+		}
+
 		if (!visit(u_ptr->m_argument, out))
 		{
 			return false;
@@ -32,29 +341,30 @@ bool Interpreter::visit(const Node* ast, std::ostream& out)
 
 	if (b_ptr)
 	{
-		if (dynamic_cast<const Function_Token*>(b_ptr->m_token)->m_name == "concat")
+		if (is_list_builtin(dynamic_cast<const Function_Token*>(b_ptr->m_token)->m_name))
 		{
-			const List_Operation_Node* l1 = dynamic_cast<const List_Operation_Node*>(b_ptr->m_left);
-			const List_Operation_Node* l2 = dynamic_cast<const List_Operation_Node*>(b_ptr->m_right);
+			return evaluate_operands(b_ptr, out) && visit_list_function(b_ptr, out);
+		}
 
-			std::vector<Node*> result = l1->m_contents;
+		if (m_lazy && !is_binary_builtin(dynamic_cast<const Function_Token*>(b_ptr->m_token)->m_name))
+		{
+			return delay(b_ptr->m_left, out) && delay(b_ptr->m_right, out) && call_user(dynamic_cast<const Function_Token*>(b_ptr->m_token)->m_name, 2, out);
+		}
 
-			for (Node* a : l2->m_contents)
-			{
-				result.push_back(a->clone());
-			}
+		if (!visit(b_ptr->m_left, out))
+		{
+			return false;
+		}
 
-			List_Operation_Node* n = new List_Operation_Node(new Token(l1->m_token->m_type), result);
-			bool b = visit(n, out);
-			delete n;
-			for (Node* a : result)
-			{
-				a = nullptr;
-			}
-			return b;
+		// nand is 1 as soon as its left side is 0.
+		if (m_lazy && dynamic_cast<const Function_Token*>(b_ptr->m_token)->m_name == "nand" && is_zero(m_results[m_results.size() - 1]))
+		{
+			m_results.pop();
+			m_results.push(truth(true));
+			return true;
 		}
 
-		if (!visit(b_ptr->m_left, out) || !visit(b_ptr->m_right, out) || !visit_binary(b_ptr, out))
+		if (!visit(b_ptr->m_right, out) || !visit_binary(b_ptr, out))
 		{
 			return false;
 		}
@@ -73,23 +383,46 @@ bool Interpreter::visit(const Node* ast, std::ostream& out)
 
 	if (l_ptr)
 	{
-		return visit_list(l_ptr, out);
+		return evaluate_operands(l_ptr, out) && visit_list(l_ptr, out);
 	}
 
 	const Map_Operation_Node* m_ptr = dynamic_cast<const Map_Operation_Node*>(ast);
 
 	if (m_ptr)
-	{	
-		List_Operation_Node* n = new List_Operation_Node(new Token(m_ptr->m_functor->m_token->m_type), visit_map(m_ptr, out));
-		bool b = visit(n, out);
-		delete n;
-		return b;
+	{
+		return evaluate_operands(m_ptr, out) && visit_map(m_ptr, out);
+	}
+
+	const Reduce_Operation_Node* r_ptr = dynamic_cast<const Reduce_Operation_Node*>(ast);
+
+	if (r_ptr)
+	{
+		return evaluate_operands(r_ptr, out) && visit_reduce(r_ptr, out);
+	}
+
+	const Filter_Operation_Node* fi_ptr = dynamic_cast<const Filter_Operation_Node*>(ast);
+
+	if (fi_ptr)
+	{
+		return evaluate_operands(fi_ptr, out) && visit_filter(fi_ptr, out);
+	}
+
+	const Zip_Operation_Node* z_ptr = dynamic_cast<const Zip_Operation_Node*>(ast);
+
+	if (z_ptr)
+	{
+		return evaluate_operands(z_ptr, out) && visit_zip(z_ptr, out);
 	}
 
 	const User_Function* u_f_ptr = dynamic_cast<const User_Function*>(ast);
 
 	if (u_f_ptr)
 	{
+		if (is_axpy(u_f_ptr))
+		{
+			return evaluate_operands(u_f_ptr, out) && visit_linear("axpy", out);
+		}
+
 		if (!visit_user(u_f_ptr, out))
 		{
 			return false;
@@ -106,14 +439,28 @@ bool Interpreter::visit_factor(const Factor_Node* node, std::ostream& out)
 {
 	const Number_Token* number = dynamic_cast<const Number_Token*>(node->m_token);
 
-	if (number)
+	if (!number)
 	{
-		m_results.push(number->m_value);
+		Runtime_Error("Expected a number").print(out);
+		return false;
+	}
+
+	if (m_numbers == Numbers::INT64)
+	{
+		int64_t integer = number->m_integer;
+
+		if (!number->m_is_integer && !Arithmetic<int64_t>::from(number->m_value, integer))
+		{
+			Runtime_Error("Expected an integer").print(out);
+			return false;
+		}
+
+		m_results.push(Value(integer));
 		return true;
 	}
 
-	Runtime_Error("Expected a number").print(out);
-	return false;
+	m_results.push(narrow(number->m_value));
+	return true;
 }
 
 bool Interpreter::visit_argument(const Argument_Node* node, std::ostream& out)
@@ -122,13 +469,26 @@ bool Interpreter::visit_argument(const Argument_Node* node, std::ostream& out)
 
 	if (current)
 	{
-		if (current->m_value >= m_arguments.size())
+		if (current->m_value >= m_arity)
 		{
 			Runtime_Error("Too few arguments in function call").print(out);
 			return false;
 		}
 
-		m_results.push(m_arguments[m_offset + current->m_value]);
+		Value value = m_results[m_base + current->m_value]; // The push may move the stack.
+		Thunk_Value* thunk = value.thunk();
+
+		if (thunk)
+		{
+			if (!force(thunk, out))
+			{
+				return false;
+			}
+
+			value = thunk->m_value;
+		}
+
+		m_results.push(std::move(value));
 		return true;
 	}
 
@@ -140,381 +500,2994 @@ bool Interpreter::visit_unary(const Unary_Operation_Node* node, std::ostream& ou
 {
 	const Function_Token* f_token = dynamic_cast<const Function_Token*>(node->m_token);
 
-	if (f_token->m_name == "sqrt")
+	if (is_list_builtin(f_token->m_name))
 	{
-		m_results.push(sqrt(m_results.pop()));
-		return true;
+		return visit_list_function(node, out);
 	}
 
-	if (f_token->m_name == "sin")
+	if (!is_unary_builtin(f_token->m_name))
 	{
-		m_results.push(sin(m_results.pop()));
-		return true;
+		return call_user(f_token->m_name, 1, out);
 	}
 
-	if (f_token->m_name == "cos")
+	if (!m_results[m_results.size() - 1].is_number())
 	{
-		m_results.push(cos(m_results.pop()));
-		return true;
+		return apply_builtin(f_token->m_name, out);
 	}
 
-	for (const Node* a : m_user_functions)
-	{
-		const User_Function* current_ptr = dynamic_cast<const User_Function*>(a);
-
-		if (current_ptr)
-		{
-			const Function_Token* current_name = dynamic_cast<const Function_Token*>(current_ptr->m_token);
+	return arithmetic(f_token->m_name, 1, out);
+}
 
-			if (current_name->m_name == dynamic_cast<const Function_Token*>(node->m_token)->m_name)
-			{
-				size_t size = m_arguments.size();
-				size_t diff = size - m_offset;
-				m_offset = size == 0 ? 0 : size;
+bool Interpreter::visit_binary(const Binary_Operation_Node* node, std::ostream& out)
+{
+	const Function_Token* f_token = dynamic_cast<const Function_Token*>(node->m_token);
 
-				m_arguments.push_back(m_results.pop());
+	if (!is_binary_builtin(f_token->m_name))
+	{
+		return call_user(f_token->m_name, 2, out);
+	}
 
-				if (!visit(current_ptr->m_definition, out))
-				{
-					return false;
-				}
+	size_t top = m_results.size() - 1;
 
-				m_offset -= diff;
-				m_arguments.pop_back();
-				return true;
-			}
-		}
+	if (f_token->m_name == "pow" && (!m_results[top].is_number() || !m_results[top - 1].is_number()))
+	{
+		return visit_pow(out);
 	}
 
-	Runtime_Error("No matching function definition found").print(out);
-	return false;
+	return arithmetic(f_token->m_name, 2, out);
 }
 
-bool Interpreter::visit_binary(const Binary_Operation_Node* node, std::ostream& out)
+bool Interpreter::visit_if(const If_Opeation_Node* node, std::ostream& out)
 {
-	double right = m_results.pop();
-	double left = m_results.pop();
-
-	const Function_Token* f_token = dynamic_cast<const Function_Token*>(node->m_token);
+	double check;
 
-	if (f_token->m_name == "add")
+	if (!visit(node->m_check, out) || !pop_number(check, out))
 	{
-		m_results.push(left + right);
-		return true;
+		return false;
 	}
-	if (f_token->m_name == "sub")
+
+	if (is_zero(check))
 	{
-		m_results.push(left - right);
-		return true;
+		return visit(node->m_right, out);
 	}
-	if (f_token->m_name == "mul")
+
+	return visit(node->m_left, out);
+}
+
+bool Interpreter::visit_list(const List_Operation_Node* node, std::ostream& out)
+{
+	if (m_numbers == Numbers::INT64)
 	{
-		m_results.push(left * right);
-		return true;
+		Runtime_Error("Lists need floating point numbers").print(out);
+		return false;
 	}
-	if (f_token->m_name == "div")
+
+	std::vector<double> elements(node->m_contents.size());
+
+	for (size_t i = elements.size(); i-- > 0;)
 	{
-		if (right == 0)
+		if (!pop_number(elements[i], out))
 		{
-			Runtime_Error("Division by 0").print(out);
 			return false;
 		}
-
-		m_results.push(left / right);
-		return true;
 	}
-	if (f_token->m_name == "pow")
+
+	m_results.push(list_of(std::move(elements)));
+	return true;
+}
+
+bool Interpreter::visit_map(const Map_Operation_Node* node, std::ostream& out)
+{
+	const Function_Token* f_name = dynamic_cast<const Function_Token*>(node->m_functor->m_token);
+
+	if (!f_name)
 	{
-		m_results.push(pow(left, right));
-		return true;
+		Runtime_Error("Function could not be deduced").print(out);
+		return false;
 	}
-	if (f_token->m_name == "eq")
+
+	if (is_unary_builtin(f_name->m_name))
 	{
-		m_results.push(left == right);
-		return true;
+		return apply_builtin(f_name->m_name, out);
 	}
-	if (f_token->m_name == "le")
+
+	// map(g, map(f, l)) calls f and then g on every element, in one pass, instead of building the list in between.
+	std::vector<const User_Function*> functions;
+	const Node* source = source_of(node);
+
+	for (const Node* a = node; a != source; a = dynamic_cast<const Map_Operation_Node*>(a)->m_list)
 	{
-		m_results.push(left < right);
-		return true;
+		const User_Function* map_ptr = find_function(dynamic_cast<const Function_Token*>(dynamic_cast<const Map_Operation_Node*>(a)->m_functor->m_token)->m_name);
+
+		if (!map_ptr)
+		{
+			Runtime_Error("No mathing function definition found").print(out);
+			return false;
+		}
+
+		functions.push_back(map_ptr);
 	}
-	if (f_token->m_name == "nand")
+
+	std::reverse(functions.begin(), functions.end()); // The innermost map goes first.
+
+	// Likewise the parts of a concat get mapped straight into the result instead of being joined first.
+	std::vector<const Node*> parts;
+	collect_parts(source, parts);
+
+	const Sequence_Value* sequence = parts.size() == 1 ? m_results.top().sequence() : nullptr;
+
+	// Mapping over a sequence only adds the functions to it. The elements get computed as they are needed.
+	if (sequence)
 	{
-		m_results.push(!left || !right);
+		Value list = m_results.pop();
+		std::vector<const User_Function*> all = sequence->m_functions;
+		all.insert(all.end(), functions.begin(), functions.end());
+
+		m_results.push(Value(new Sequence_Value(sequence->m_start, sequence->m_step, sequence->m_count, all)));
 		return true;
 	}
 
-	for (const Node* a : m_user_functions)
+	std::vector<Value> lists(parts.size());
+	std::vector<double> elements;
+
+	if (!pop_lists(lists, out))
 	{
-		const User_Function* current_ptr = dynamic_cast<const User_Function*>(a);
+		return false;
+	}
 
-		if (current_ptr)
-		{
-			const Function_Token* current_name = dynamic_cast<const Function_Token*>(current_ptr->m_token);
+	size_t size = 0;
 
-			if (current_name->m_name == dynamic_cast<const Function_Token*>(node->m_token)->m_name)
-			{
-				size_t size = m_arguments.size();
-				size_t diff = size - m_offset;
-				m_offset = size == 0 ? 0 : size;
+	for (const Value& a : lists)
+	{
+		size += a.size();
+	}
 
-				m_arguments.push_back(left);
-				m_arguments.push_back(right);
+	elements.reserve(size);
 
-				if (!visit(current_ptr->m_definition, out))
-				{
-					return false;
-				}
+	auto gather = [&elements](const double* chunk, size_t count)
+	{
+		elements.insert(elements.end(), chunk, chunk + count);
+		return true;
+	};
 
-				m_offset -= diff;
-				m_arguments.pop_back();
-				m_arguments.pop_back();
+	for (const Value& a : lists)
+	{
+		a.for_each_chunk(gather);
+	}
 
-				return true;
-			}
-		}
+	if (!apply(functions, elements.data(), elements.size(), out))
+	{
+		return false;
 	}
 
-	Runtime_Error("No matching function definition found").print(out);
-	return false;
+	m_results.push(list_of(std::move(elements)));
+	return true;
 }
 
-bool Interpreter::visit_if(const If_Opeation_Node* node, std::ostream& out)
+bool Interpreter::apply_builtin(const std::string& name, std::ostream& out)
 {
-	if (!visit(node->m_check, out))
+	Value list;
+
+	if (!pop_list(list, out))
 	{
 		return false;
 	}
 
-	if (m_results.pop() == 0)
+	// Floats stay floats, so that the kernels get twice as many of them to a vector.
+	if (list.is_single())
 	{
-		return visit(node->m_right, out);
+		std::vector<float> elements(list.size());
+		float* next = elements.data();
+
+		list.for_each_float_chunk([this, &name, &next](const float* chunk, size_t count)
+		{
+			unary(name, chunk, next, count);
+			next += count;
+			return true;
+		});
+
+		m_results.push(Value(std::move(elements)));
+		return true;
 	}
 
-	return visit(node->m_left, out);
+	std::vector<double> elements(list.size());
+	double* next = elements.data();
+
+	list.for_each_chunk([this, &name, &next](const double* chunk, size_t count)
+	{
+		unary(name, chunk, next, count);
+		next += count;
+		return true;
+	});
+
+	m_results.push(list_of(std::move(elements)));
+	return true;
 }
 
-bool Interpreter::visit_list(const List_Operation_Node* node, std::ostream& out)
+bool Interpreter::visit_pow(std::ostream& out)
 {
-	out << '[';
+	Value exponent = m_results.pop();
+	Value base = m_results.pop();
 
-	std::vector<Node*>::const_iterator it = node->m_contents.begin();
-
-	while (it + 1 != node->m_contents.end())
+	// Sequences get turned into lists. A number stands for as many copies of itself as the list has elements.
+	if (!exponent.is_number())
 	{
-		if (!visit(*it, out))
+		m_results.push(std::move(exponent));
+
+		if (!pop_list(exponent, out))
 		{
 			return false;
 		}
-		out << m_results.pop() << ", ";
+	}
+
+	if (!base.is_number())
+	{
+		m_results.push(std::move(base));
 
-		++it;
+		if (!pop_list(base, out))
+		{
+			return false;
+		}
 	}
 
-	if (!visit(*it, out))
+	if (!base.is_number() && !exponent.is_number() && base.size() != exponent.size())
 	{
+		Runtime_Error("Expected lists of the same length").print(out);
 		return false;
 	}
-	out << m_results.pop() << ']';
 
+	size_t size = base.is_number() ? exponent.size() : base.size();
+
+	if (m_numbers == Numbers::FLOAT32)
+	{
+		std::vector<float> bases(size, base.is_number() ? (float)base.number() : 0);
+		std::vector<float> exponents(size, exponent.is_number() ? (float)exponent.number() : 0);
+
+		if (!base.is_number())
+		{
+			copy_elements(base, bases.data());
+		}
+
+		if (!exponent.is_number())
+		{
+			copy_elements(exponent, exponents.data());
+		}
+
+		vector_pow(bases.data(), exponents.data(), bases.data(), size, m_accuracy);
+
+		m_results.push(Value(std::move(bases)));
+		return true;
+	}
+
+	std::vector<double> bases(size, base.is_number() ? base.number() : 0);
+	std::vector<double> exponents(size, exponent.is_number() ? exponent.number() : 0);
+
+	if (!base.is_number())
+	{
+		copy_elements(base, bases.data());
+	}
+
+	if (!exponent.is_number())
+	{
+		copy_elements(exponent, exponents.data());
+	}
+
+	combine("pow", bases.data(), exponents.data(), size);
+
+	m_results.push(Value(std::move(bases)));
 	return true;
 }
 
-std::vector<Node*> Interpreter::visit_map(const Map_Operation_Node* node, std::ostream& out)
+bool Interpreter::visit_reduce(const Reduce_Operation_Node* node, std::ostream& out)
 {
-	const Function_Token* f_name = dynamic_cast<const Function_Token*>(node->m_list->m_token);
-	const Function_Token* l_name = dynamic_cast<const Function_Token*>(node->m_functor->m_token);
+	std::string name;
+	const User_Function* function;
 
-	if (!f_name || !l_name)
+	if (!find_functor(node->m_functor, name, function, out))
 	{
-		Runtime_Error("Function could not be deduced").print(out);
-		return {};
+		return false;
 	}
 
-	// Go and find their pointers.
-
-	const User_Function* map_ptr = nullptr;
-	const List_Operation_Node* list_ptr = nullptr;
+	if (!function && !is_binary_builtin(name))
+	{
+		Runtime_Error("Expected a function of two arguments").print(out);
+		return false;
+	}
 
-	size_t j = 0;
+	double accumulator = 0;
+	Value list;
 
-	for (const Node* a : m_user_functions)
+	if (!pop_list(list, out) || (node->m_initial && !pop_number(accumulator, out)))
 	{
-		const User_Function* current_ptr = dynamic_cast<const User_Function*>(a);
-
-		if (current_ptr)
-		{
-			const Function_Token* current_name = dynamic_cast<const Function_Token*>(current_ptr->m_token);
+		return false;
+	}
 
-			if (current_name->m_name == f_name->m_name || current_name->m_name == l_name->m_name)
-			{				
-				if (current_name->m_name == f_name->m_name)
-				{
-					map_ptr = dynamic_cast<const User_Function*>(current_ptr);
-					++j;
-				}
-				else
-				{
-					list_ptr = dynamic_cast<const List_Operation_Node*>(current_ptr->m_definition);
-					++j;
-				}
-			}
-		}
-		if (j == 2)
+	// Without an initial value the first element is one.
+	if (!node->m_initial)
+	{
+		if (list.size() == 0)
 		{
-			break;
+			Runtime_Error("Expected a list that is not empty").print(out);
+			return false;
 		}
+
+		accumulator = list.at(0);
+		list = Value::slice(list, 1, list.size() - 1);
 	}
 
-	if (j < 2)
+	if (!function && is_associative_builtin(name))
 	{
-		Runtime_Error("No mathing function definition found").print(out);
-		return {};
-	}
+		double rest = total(name, list);
 
-	std::vector<Node*> new_contents;
+		combine(name, &accumulator, &rest, 1);
+		m_results.push(accumulator);
+		return true;
+	}
 
-	if (list_ptr && map_ptr)
+	bool folded = list.for_each_chunk([this, &name, function, &accumulator, &out](const double* chunk, size_t count)
 	{
-		for (const Node* a : list_ptr->m_contents)
+		for (size_t i = 0; i < count; ++i)
 		{
-			if (!visit(a, out))
+			if (function)
 			{
-				return {};
-			}
+				m_results.push(accumulator);
+				m_results.push(chunk[i]);
 
-			m_arguments.push_back(m_results.pop());
-
-			if (!visit(map_ptr->m_definition, out))
+				if (!call_user(function, 2, out) || !pop_number(accumulator, out))
+				{
+					return false;
+				}
+			}
+			else if (!combine(name, &accumulator, chunk + i, 1))
 			{
-				return {};
+				Runtime_Error("Division by 0").print(out);
+				return false;
 			}
+		}
 
-			++m_offset;
-
-			new_contents.push_back(new Factor_Node(new Number_Token(m_results.pop())));
+		return true;
+	});
 
-			--m_offset;
-			m_arguments.pop_back();
-		}
+	if (!folded)
+	{
+		return false;
 	}
 
-	return new_contents;
+	m_results.push(accumulator);
+	return true;
 }
 
-bool Interpreter::visit_user(const User_Function* node, std::ostream& out)
+bool Interpreter::visit_filter(const Filter_Operation_Node* node, std::ostream& out)
 {
-	for (const Node* a : m_user_functions)
+	std::string name;
+	const User_Function* function;
+
+	if (!find_functor(node->m_functor, name, function, out))
 	{
-		const User_Function* current_ptr = dynamic_cast<const User_Function*>(a);
+		return false;
+	}
 
-		if (current_ptr)
-		{
-			const Function_Token* current_name = dynamic_cast<const Function_Token*>(current_ptr->m_token);
+	if (!function && !is_unary_builtin(name))
+	{
+		Runtime_Error("Expected a function of one argument").print(out);
+		return false;
+	}
 
-			if (current_name->m_name == dynamic_cast<const Function_Token*>(node->m_token)->m_name)
-			{
-				if (node->m_definition)
-				{
-					Runtime_Error("A function with the same name already exists").print(out);
-					return false;
-				}
+	Value list;
 
-				if (node->m_arguments.size() == 0)
-				{
-					return visit(current_ptr->m_definition, out);
-				}
+	if (!pop_list(list, out))
+	{
+		return false;
+	}
 
-				for (const Node* a : node->m_arguments)
-				{
-					if (!visit(a, out))
-					{
-						return false;
-					}
-				}
+	std::vector<double> elements = list.elements();
 
-				size_t size = m_arguments.size();
-				size_t diff = size - m_offset;
-				m_offset = size == 0 ? 0 : size;
+	// The checks are computed like a map, so they get the columns and the threads as well.
+	std::vector<double> checks(elements);
 
-				size = m_results.size() + m_offset;
+	if (!function)
+	{
+		unary(name, checks.data(), checks.data(), checks.size());
+	}
+	else if (!apply({ function }, checks.data(), checks.size(), out))
+	{
+		return false;
+	}
 
-				if (size > m_arguments.size())
-				{
-					m_arguments.resize(size);
-				}
+	size_t kept = 0;
 
-				while (!m_results.is_empty() && size)
-				{
-					m_arguments[--size] = m_results.pop();
-				}
+	for (size_t i = 0; i < elements.size(); ++i)
+	{
+		if (checks[i] != 0)
+		{
+			elements[kept++] = elements[i];
+		}
+	}
 
-				if (!visit(current_ptr->m_definition, out))
-				{
-					return false;
-				}
+	elements.resize(kept);
+	m_results.push(list_of(std::move(elements)));
+	return true;
+}
 
-				m_offset -= diff;
+bool Interpreter::visit_zip(const Zip_Operation_Node* node, std::ostream& out)
+{
+	std::string name;
+	const User_Function* function;
 
-				m_arguments.clear();
+	if (!find_functor(node->m_functor, name, function, out))
+	{
+		return false;
+	}
 
-				return true;
-			}
-		}
+	if (!function && !is_binary_builtin(name))
+	{
+		Runtime_Error("Expected a function of two arguments").print(out);
+		return false;
 	}
 
-	if (!node->m_definition)
+	Value left;
+	Value right;
+
+	if (!pop_list(right, out) || !pop_list(left, out))
 	{
-		Runtime_Error("Expected \"<-\"").print(out);
 		return false;
 	}
 
-	const Function_Token* function_name = dynamic_cast<const Function_Token*>(node->m_token);
-	const Function_Token* its_definition = dynamic_cast<const Function_Token*>(node->m_definition->m_token);
+	size_t size = left.size() < right.size() ? left.size() : right.size();
+	std::vector<double> elements;
+	std::vector<double> others;
 
-	if(function_name && its_definition && function_name->m_name == its_definition->m_name)
+	elements.reserve(size);
+	others.reserve(size);
+
+	Value::slice(left, 0, size).for_each_chunk([&elements](const double* chunk, size_t count)
+	{
+		elements.insert(elements.end(), chunk, chunk + count);
+		return true;
+	});
+
+	Value::slice(right, 0, size).for_each_chunk([&others](const double* chunk, size_t count)
+	{
+		others.insert(others.end(), chunk, chunk + count);
+		return true;
+	});
+
+	if (!function)
+	{
+		if (!combine(name, elements.data(), others.data(), size))
+		{
+			Runtime_Error("Division by 0").print(out);
+			return false;
+		}
+	}
+	else if (!call_each(function, { elements.data(), others.data() }, size, elements.data(), out))
 	{
-		Runtime_Error("Function will cause stack overflow and hence will not be created").print(out);
 		return false;
 	}
 
-	m_user_functions.push_back(node);
+	m_results.push(list_of(std::move(elements)));
 	return true;
 }
 
-Interpreter::Interpreter()
-	: m_offset(0)
-{ }
-
-Interpreter::~Interpreter()
+bool Interpreter::find_functor(const Node* functor, std::string& name, const User_Function*& function, std::ostream& out) const
 {
-	for (const Node* a : m_user_functions)
+	const Function_Token* f_name = dynamic_cast<const Function_Token*>(functor->m_token);
+
+	if (!f_name)
 	{
-		delete a;
-		a = nullptr;
+		Runtime_Error("Function could not be deduced").print(out);
+		return false;
+	}
+
+	name = f_name->m_name;
+	function = is_unary_builtin(name) || is_binary_builtin(name) ? nullptr : find_function(name);
+
+	if (!function && !is_unary_builtin(name) && !is_binary_builtin(name))
+	{
+		Runtime_Error("No matching function definition found").print(out);
+		return false;
 	}
+
+	return true;
 }
 
-void Interpreter::interpret(const Node* ast, std::ostream& out)
+double Interpreter::total(const std::string& name, const Value& list)
 {
-	if (!visit(ast, out))
+	std::vector<double> buffer;
+	std::vector<std::pair<const double*, size_t>> blocks = blocks_of(list, buffer);
+	std::vector<double> partials(blocks.size());
+
+	// Every block gets combined on its own, then the results of the blocks.
+	auto combine = [&name](const double* elements, size_t count)
 	{
-		m_offset = 0;
-		m_arguments.clear();
-		while (!m_results.is_empty())
+		if (name == "add")
 		{
-			m_results.pop();
+			return tree(elements, count, 0.0, std::plus<double>());
 		}
-		return;
+
+		if (name == "mul")
+		{
+			return tree(elements, count, 1.0, std::multiplies<double>());
+		}
+
+		if (name == "min")
+		{
+			return tree(elements, count, INFINITY, [](double a, double b) { return b < a ? b : a; });
+		}
+
+		return tree(elements, count, -INFINITY, [](double a, double b) { return b > a ? b : a; });
+	};
+
+	std::function<void(size_t)> task = [&combine, &blocks, &partials](size_t i)
+	{
+		partials[i] = combine(blocks[i].first, blocks[i].second);
+	};
+
+	run_blocks(blocks.size(), list.size(), task);
+
+	return combine(partials.data(), partials.size());
+}
+
+double Interpreter::sum(const Value& list)
+{
+	if (m_summation == Summation::PAIRWISE)
+	{
+		return total("add", list);
 	}
 
-	if (!m_results.is_empty())
+	std::vector<double> buffer;
+	std::vector<std::pair<const double*, size_t>> blocks = blocks_of(list, buffer);
+	std::vector<double> sums(blocks.size());
+	std::vector<double> compensations(blocks.size());
+
+	std::function<void(size_t)> task = [&blocks, &sums, &compensations](size_t i)
+	{
+		compensated(blocks[i].first, blocks[i].second, sums[i], compensations[i]);
+	};
+
+	run_blocks(blocks.size(), list.size(), task);
+
+	double sum;
+	double compensation;
+
+	compensated(sums.data(), sums.size(), sum, compensation);
+
+	for (double a : compensations)
 	{
-		out << m_results.pop();
+		compensation += a;
 	}
 
-	if (!m_results.is_empty() || !m_arguments.empty() || m_offset != 0)
+	return sum + compensation;
+}
+
+std::vector<std::pair<const double*, size_t>> Interpreter::blocks_of(const Value& list, std::vector<double>& buffer)
+{
+	std::vector<std::pair<const double*, size_t>> blocks;
+
+	auto cut = [&blocks](const double* chunk, size_t count)
 	{
-		Runtime_Error("Unexpected argument").print(out);
+		for (size_t i = 0; i < count; i += BLOCK_SIZE)
+		{
+			blocks.push_back({ chunk + i, count - i < BLOCK_SIZE ? count - i : BLOCK_SIZE });
+		}
+
+		return true;
+	};
+
+	if (list.is_single())
+	{
+		buffer = list.elements();
+		cut(buffer.data(), buffer.size());
+	}
+	else
+	{
+		list.for_each_chunk(cut);
+	}
+
+	return blocks;
+}
+
+void Interpreter::run_blocks(size_t blocks, size_t elements, const std::function<void(size_t)>& task)
+{
+	if (elements >= m_parallel_threshold)
+	{
+		m_pool.run(blocks, task);
+		return;
+	}
+
+	for (size_t i = 0; i < blocks; ++i)
+	{
+		task(i);
+	}
+}
+
+bool Interpreter::call_each(const User_Function* function, const std::vector<const double*>& arguments, size_t count, double* results, std::ostream& out)
+{
+	size_t blocks = (count + BLOCK_SIZE - 1) / BLOCK_SIZE;
+	std::vector<char> done(blocks, false);
+
+	std::function<void(size_t)> task = [this, function, &arguments, count, results, &done](size_t block)
+	{
+		size_t first = block * BLOCK_SIZE;
+		size_t size = count - first < BLOCK_SIZE ? count - first : BLOCK_SIZE;
+		std::vector<const double*> columns;
+
+		for (const double* a : arguments)
+		{
+			columns.push_back(a + first);
+		}
+
+		done[block] = apply_column(function, columns, size, results + first) || apply_native(function, columns, size, results + first);
+	};
+
+	run_blocks(blocks, count, task);
+
+	count_calls(function, count);
+
+	// Same as apply: the rest in order, so that the error is the one of the first row that fails.
+	for (size_t i = 0; i < blocks; ++i)
+	{
+		for (size_t j = i * BLOCK_SIZE; !done[i] && j < count && j < (i + 1) * BLOCK_SIZE; ++j)
+		{
+			for (const double* a : arguments)
+			{
+				m_results.push(a[j]);
+			}
+
+			if (!call_user(function, arguments.size(), out) || !pop_number(results[j], out))
+			{
+				return false;
+			}
+		}
+	}
+
+	return true;
+}
+
+void Interpreter::collect_parts(const Node* node, std::vector<const Node*>& parts) const
+{
+	const Binary_Operation_Node* b_ptr = dynamic_cast<const Binary_Operation_Node*>(node);
+
+	if (b_ptr && dynamic_cast<const Function_Token*>(b_ptr->m_token)->m_name == "concat")
+	{
+		collect_parts(b_ptr->m_left, parts);
+		collect_parts(b_ptr->m_right, parts);
+		return;
+	}
+
+	parts.push_back(node);
+}
+
+const Node* Interpreter::operand(const Node* node, size_t index) const
+{
+	if (const Binary_Operation_Node* b_ptr = dynamic_cast<const Binary_Operation_Node*>(node))
+	{
+		// The first operand of a file builtin is the name of the file, which is not evaluated.
+		if (is_file_builtin(dynamic_cast<const Function_Token*>(b_ptr->m_token)->m_name))
+		{
+			return index == 0 ? b_ptr->m_right : nullptr;
+		}
+
+		return index == 0 ? b_ptr->m_left : index == 1 ? b_ptr->m_right : nullptr;
+	}
+
+	if (const User_Function* u_f_ptr = dynamic_cast<const User_Function*>(node))
+	{
+		return index < u_f_ptr->m_arguments.size() ? u_f_ptr->m_arguments[index] : nullptr;
+	}
+
+	if (const List_Operation_Node* l_ptr = dynamic_cast<const List_Operation_Node*>(node))
+	{
+		return index < l_ptr->m_contents.size() ? l_ptr->m_contents[index] : nullptr;
+	}
+
+	if (const Map_Operation_Node* m_ptr = dynamic_cast<const Map_Operation_Node*>(node))
+	{
+		const Function_Token* f_name = dynamic_cast<const Function_Token*>(m_ptr->m_functor->m_token);
+
+		if (!f_name || is_unary_builtin(f_name->m_name))
+		{
+			return f_name && index == 0 ? m_ptr->m_list : nullptr;
+		}
+
+		// A chain of maps goes over the parts of the concat under it (see visit_map).
+		std::vector<const Node*> parts;
+		collect_parts(source_of(m_ptr), parts);
+
+		return index < parts.size() ? parts[index] : nullptr;
+	}
+
+	if (const Reduce_Operation_Node* r_ptr = dynamic_cast<const Reduce_Operation_Node*>(node))
+	{
+		const Node* operands[] = { r_ptr->m_initial, r_ptr->m_list };
+
+		index += !r_ptr->m_initial;
+		return index < 2 ? operands[index] : nullptr;
+	}
+
+	if (const Filter_Operation_Node* f_ptr = dynamic_cast<const Filter_Operation_Node*>(node))
+	{
+		return index == 0 ? f_ptr->m_list : nullptr;
+	}
+
+	if (const Zip_Operation_Node* z_ptr = dynamic_cast<const Zip_Operation_Node*>(node))
+	{
+		return index == 0 ? z_ptr->m_left : index == 1 ? z_ptr->m_right : nullptr;
+	}
+
+	return nullptr;
+}
+
+bool Interpreter::evaluate_operands(const Node* node, std::ostream& out)
+{
+	for (size_t i = 0; const Node* a = operand(node, i); ++i)
+	{
+		if (!evaluate(a, out))
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+bool Interpreter::visit_evaluated(const Node* node, std::ostream& out)
+{
+	if (const Binary_Operation_Node* b_ptr = dynamic_cast<const Binary_Operation_Node*>(node))
+	{
+		return visit_list_function(b_ptr, out);
+	}
+
+	if (dynamic_cast<const User_Function*>(node))
+	{
+		return visit_linear("axpy", out);
+	}
+
+	if (const List_Operation_Node* l_ptr = dynamic_cast<const List_Operation_Node*>(node))
+	{
+		return visit_list(l_ptr, out);
+	}
+
+	if (const Map_Operation_Node* m_ptr = dynamic_cast<const Map_Operation_Node*>(node))
+	{
+		return visit_map(m_ptr, out);
+	}
+
+	if (const Reduce_Operation_Node* r_ptr = dynamic_cast<const Reduce_Operation_Node*>(node))
+	{
+		return visit_reduce(r_ptr, out);
+	}
+
+	if (const Filter_Operation_Node* f_ptr = dynamic_cast<const Filter_Operation_Node*>(node))
+	{
+		return visit_filter(f_ptr, out);
+	}
+
+	if (const Zip_Operation_Node* z_ptr = dynamic_cast<const Zip_Operation_Node*>(node))
+	{
+		return visit_zip(z_ptr, out);
+	}
+
+	Runtime_Error("No matching definition found").print(out);
+	return false;
+}
+
+bool Interpreter::visit_list_function(const Binary_Operation_Node* node, std::ostream& out)
+{
+	const std::string& name = dynamic_cast<const Function_Token*>(node->m_token)->m_name;
+
+	if (is_file_builtin(name))
+	{
+		return visit_file_function(node, out);
+	}
+
+	if (name == "concat")
+	{
+		Value left;
+		Value right;
+
+		if (!pop_list(right, out) || !pop_list(left, out))
+		{
+			return false;
+		}
+
+		// The lists are ropes so this only copies when they are short.
+		m_results.push(Value::concat(left, right));
+		return true;
+	}
+
+	if (name == "dot" || name == "matvec")
+	{
+		return visit_linear(name, out);
+	}
+
+	if (name == "take" || name == "drop")
+	{
+		Value list = m_results.pop();
+		const Sequence_Value* sequence = list.sequence();
+		double left;
+
+		if (!pop_number(left, out))
+		{
+			return false;
+		}
+
+		size_t count = count_of(left);
+
+		if (sequence)
+		{
+			size_t taken = std::min(count, sequence->m_count);
+
+			if (name == "take")
+			{
+				m_results.push(Value(new Sequence_Value(sequence->m_start, sequence->m_step, taken, sequence->m_functions)));
+			}
+			else
+			{
+				size_t rest = sequence->m_count == Sequence_Value::ENDLESS ? Sequence_Value::ENDLESS : sequence->m_count - taken;
+				m_results.push(Value(new Sequence_Value(sequence->m_start + taken * sequence->m_step, sequence->m_step, rest, sequence->m_functions)));
+			}
+
+			return true;
+		}
+
+		if (!list.is_list())
+		{
+			Runtime_Error("Expected a list").print(out);
+			return false;
+		}
+
+		size_t taken = std::min(count, list.size());
+
+		// Either way the result is a view of the list.
+		m_results.push(name == "take" ? Value::slice(list, 0, taken) : Value::slice(list, taken, list.size() - taken));
+		return true;
+	}
+
+	if (m_numbers == Numbers::INT64)
+	{
+		Runtime_Error("Lists need floating point numbers").print(out);
+		return false;
+	}
+
+	double left;
+	double right;
+
+	if (!pop_number(right, out) || !pop_number(left, out))
+	{
+		return false;
+	}
+
+	if (name == "range")
+	{
+		m_results.push(Value(new Sequence_Value(left, 1, count_of(std::ceil(right - left)), {})));
+		return true;
+	}
+
+	// The only one left is from.
+	m_results.push(Value(new Sequence_Value(left, right, Sequence_Value::ENDLESS, {})));
+	return true;
+}
+
+bool Interpreter::visit_list_function(const Unary_Operation_Node* node, std::ostream& out)
+{
+	const std::string& name = dynamic_cast<const Function_Token*>(node->m_token)->m_name;
+
+	if (name == "norm")
+	{
+		return visit_linear(name, out);
+	}
+
+	if (name != "head" && name != "tail")
+	{
+		return visit_aggregate(name, out);
+	}
+
+	Value list = m_results.pop();
+	const Sequence_Value* sequence = list.sequence();
+
+	if (sequence)
+	{
+		if (sequence->m_count == 0)
+		{
+			Runtime_Error("Expected a list that is not empty").print(out);
+			return false;
+		}
+
+		if (name == "head")
+		{
+			double value;
+
+			if (!elements(*sequence, 0, 1, &value, out))
+			{
+				return false;
+			}
+
+			m_results.push(value);
+			return true;
+		}
+
+		// The only one left is tail.
+		size_t rest = sequence->m_count == Sequence_Value::ENDLESS ? Sequence_Value::ENDLESS : sequence->m_count - 1;
+		m_results.push(Value(new Sequence_Value(sequence->m_start + sequence->m_step, sequence->m_step, rest, sequence->m_functions)));
+		return true;
+	}
+
+	if (!list.is_list())
+	{
+		Runtime_Error("Expected a list").print(out);
+		return false;
+	}
+
+	if (list.size() == 0)
+	{
+		Runtime_Error("Expected a list that is not empty").print(out);
+		return false;
+	}
+
+	if (name == "head")
+	{
+		m_results.push(list.at(0));
+		return true;
+	}
+
+	// The only one left is tail.
+	m_results.push(Value::slice(list, 1, list.size() - 1));
+	return true;
+}
+
+bool Interpreter::visit_file_function(const Node* node, std::ostream& out)
+{
+	const std::string& name = dynamic_cast<const Function_Token*>(node->m_token)->m_name;
+	const Unary_Operation_Node* u_ptr = dynamic_cast<const Unary_Operation_Node*>(node);
+	const Node* operand = u_ptr ? u_ptr->m_argument : dynamic_cast<const Binary_Operation_Node*>(node)->m_left;
+	const Text_Token* path = operand && dynamic_cast<const Factor_Node*>(operand) ? dynamic_cast<const Text_Token*>(operand->m_token) : nullptr;
+
+	if (!path)
+	{
+		Runtime_Error("Expected the name of a file in quotes").print(out);
+		return false;
+	}
+
+	if (m_numbers == Numbers::INT64)
+	{
+		Runtime_Error("Lists need floating point numbers").print(out);
+		return false;
+	}
+
+	std::string error;
+
+	if (name == "load")
+	{
+		List_Value* list = load_doubles(path->m_text, error);
+
+		if (!list)
+		{
+			Runtime_Error(error).print(out);
+			return false;
+		}
+
+		Value value(list);
+
+		// The file keeps doubles, so floats mean copying the elements.
+		if (m_numbers == Numbers::FLOAT32)
+		{
+			std::vector<float> elements(value.size());
+			copy_elements(value, elements.data());
+			value = Value(std::move(elements));
+		}
+
+		m_results.push(std::move(value));
+		return true;
+	}
+
+	if (name == "csv")
+	{
+		double column;
+		std::vector<double> elements;
+
+		if (!pop_number(column, out))
+		{
+			return false;
+		}
+
+		if (column < 0 || column != std::floor(column))
+		{
+			Runtime_Error("Expected a column number").print(out);
+			return false;
+		}
+
+		if (!load_csv(path->m_text, count_of(column), elements, error))
+		{
+			Runtime_Error(error).print(out);
+			return false;
+		}
+
+		m_results.push(list_of(std::move(elements)));
+		return true;
+	}
+
+	Value list;
+
+	if (!pop_list(list, out))
+	{
+		return false;
+	}
+
+	if (!(name == "save" ? save_doubles(path->m_text, list, error) : save_csv(path->m_text, list, error)))
+	{
+		Runtime_Error(error).print(out);
+		return false;
+	}
+
+	m_results.push(narrow((double)list.size()));
+	return true;
+}
+
+bool Interpreter::visit_aggregate(const std::string& name, std::ostream& out)
+{
+	const Sequence_Value* sequence = m_results[m_results.size() - 1].sequence();
+
+	// The length of a sequence is known without computing its elements.
+	if (name == "length" && sequence && sequence->m_count != Sequence_Value::ENDLESS)
+	{
+		double length = (double)sequence->m_count;
+
+		m_results.pop();
+		m_results.push(length);
+		return true;
+	}
+
+	Value list;
+
+	if (!pop_list(list, out))
+	{
+		return false;
+	}
+
+	if (name == "length")
+	{
+		m_results.push((double)list.size());
+		return true;
+	}
+
+	if (name == "sum")
+	{
+		m_results.push(narrow(sum(list)));
+		return true;
+	}
+
+	if (name == "sort" || name == "argsort")
+	{
+		std::vector<double> elements = list.elements();
+
+		if (name == "sort")
+		{
+			sort(elements.begin(), elements.end(), less);
+			m_results.push(list_of(std::move(elements)));
+			return true;
+		}
+
+		std::vector<size_t> indices(elements.size());
+
+		for (size_t i = 0; i < indices.size(); ++i)
+		{
+			indices[i] = i;
+		}
+
+		// Equal elements keep their order.
+		sort(indices.begin(), indices.end(), [&elements](size_t a, size_t b)
+		{
+			return less(elements[a], elements[b]) || (!less(elements[b], elements[a]) && a < b);
+		});
+
+		std::vector<double> result(indices.begin(), indices.end());
+		m_results.push(list_of(std::move(result)));
+		return true;
+	}
+
+	if (list.size() == 0)
+	{
+		Runtime_Error("Expected a list that is not empty").print(out);
+		return false;
+	}
+
+	if (name == "mean")
+	{
+		m_results.push(narrow(sum(list) / list.size()));
+		return true;
+	}
+
+	// The only ones left are min and max.
+	m_results.push(total(name, list));
+	return true;
+}
+
+bool Interpreter::visit_linear(const std::string& name, std::ostream& out)
+{
+	if (name == "norm")
+	{
+		Value list;
+		std::vector<double> buffer;
+
+		if (!pop_list(list, out))
+		{
+			return false;
+		}
+
+		const double* elements = packed(list, buffer);
+		size_t count = list.size();
+		double largest = 0;
+
+		for (size_t i = 0; i < count; ++i)
+		{
+			largest = std::max(largest, std::fabs(elements[i]));
+		}
+
+		// The squares of numbers beyond 2^500 would overflow and those below 2^-500 underflow, so such a list gets scaled
+		// by the power of two of its largest element first (as hypot does). That is exact, so nothing else changes.
+		if ((largest > std::ldexp(1.0, 500) && std::isfinite(largest)) || (largest < std::ldexp(1.0, -500) && largest > 0))
+		{
+			int exponent = std::ilogb(largest);
+			std::vector<double> scaled(elements, elements + count);
+
+			for (double& a : scaled)
+			{
+				a = std::ldexp(a, -exponent);
+			}
+
+			m_results.push(narrow(std::ldexp(std::sqrt(dot(scaled.data(), scaled.data(), count)), exponent)));
+			return true;
+		}
+
+		m_results.push(narrow(std::sqrt(dot(elements, elements, count))));
+		return true;
+	}
+
+	Value left;
+	Value right;
+	double factor = 0;
+
+	if (!pop_list(right, out) || !pop_list(left, out) || (name == "axpy" && !pop_number(factor, out)))
+	{
+		return false;
+	}
+
+	std::vector<double> left_buffer;
+	std::vector<double> right_buffer;
+	const double* x = packed(left, left_buffer);
+	const double* y = packed(right, right_buffer);
+
+	if (name == "matvec")
+	{
+		// The matrix is a flat list, row after row, so its rows are as long as the vector.
+		size_t columns = right.size();
+
+		if (columns == 0 || left.size() % columns != 0)
+		{
+			Runtime_Error("Expected a matrix with rows as long as the vector").print(out);
+			return false;
+		}
+
+		size_t rows = left.size() / columns;
+		size_t rows_per_block = std::max<size_t>(4, BLOCK_SIZE / columns / 4 * 4);
+		std::vector<double> result(rows);
+
+		std::function<void(size_t)> task = [x, y, &result, rows, columns, rows_per_block](size_t i)
+		{
+			size_t first = i * rows_per_block;
+			size_t count = rows - first < rows_per_block ? rows - first : rows_per_block;
+
+			vector_matvec(x + first * columns, y, result.data() + first, count, columns);
+		};
+
+		run_blocks((rows + rows_per_block - 1) / rows_per_block, left.size(), task);
+
+		m_results.push(list_of(std::move(result)));
+		return true;
+	}
+
+	if (left.size() != right.size())
+	{
+		Runtime_Error("Expected lists of the same length").print(out);
+		return false;
+	}
+
+	if (name == "dot")
+	{
+		m_results.push(narrow(dot(x, y, left.size())));
+		return true;
+	}
+
+	// The only one left is axpy.
+	size_t count = left.size();
+	std::vector<double> result(count);
+
+	std::function<void(size_t)> task = [factor, x, y, &result, count](size_t i)
+	{
+		size_t first = i * BLOCK_SIZE;
+
+		vector_axpy(factor, x + first, y + first, result.data() + first, count - first < BLOCK_SIZE ? count - first : BLOCK_SIZE);
+	};
+
+	run_blocks((count + BLOCK_SIZE - 1) / BLOCK_SIZE, count, task);
+
+	m_results.push(list_of(std::move(result)));
+	return true;
+}
+
+double Interpreter::dot(const double* x, const double* y, size_t count)
+{
+	size_t blocks = (count + BLOCK_SIZE - 1) / BLOCK_SIZE;
+	std::vector<double> partials(blocks);
+
+	// The blocks do not depend on the number of threads, so neither does the result.
+	std::function<void(size_t)> task = [x, y, count, &partials](size_t i)
+	{
+		size_t first = i * BLOCK_SIZE;
+
+		partials[i] = vector_dot(x + first, y + first, count - first < BLOCK_SIZE ? count - first : BLOCK_SIZE);
+	};
+
+	run_blocks(blocks, count, task);
+
+	return tree(partials.data(), partials.size(), 0.0, std::plus<double>());
+}
+
+size_t Interpreter::count_of(const double value)
+{
+	// Anything too long to ever be computed might as well be endless.
+	return !(value > 0) ? 0 : value < Sequence_Value::ENDLESS ? (size_t)value : Sequence_Value::ENDLESS;
+}
+
+bool Interpreter::elements(const Sequence_Value& sequence, size_t index, size_t count, double* elements, std::ostream& out)
+{
+	for (size_t i = 0; i < count; ++i)
+	{
+		elements[i] = sequence.m_start + (index + i) * sequence.m_step;
+	}
+
+	narrow(elements, count);
+
+	return apply(sequence.m_functions, elements, count, out);
+}
+
+bool Interpreter::apply(const std::vector<const User_Function*>& functions, double* values, size_t count, std::ostream& out)
+{
+	size_t blocks = (count + BLOCK_SIZE - 1) / BLOCK_SIZE;
+	std::vector<size_t> done(blocks, 0); // How many of the functions each block got through.
+
+	// The blocks are independent, so a big list gets spread over the threads.
+	std::function<void(size_t)> task = [this, &functions, values, count, &done](size_t block)
+	{
+		double* first = values + block * BLOCK_SIZE;
+		size_t size = count - block * BLOCK_SIZE < BLOCK_SIZE ? count - block * BLOCK_SIZE : BLOCK_SIZE;
+
+		while (done[block] < functions.size()
+			&& (apply_column(functions[done[block]], { first }, size, first) || apply_native(functions[done[block]], { first }, size, first)))
+		{
+			++done[block];
+		}
+	};
+
+	run_blocks(blocks, count, task);
+
+	for (const User_Function* a : functions)
+	{
+		count_calls(a, count);
+	}
+
+	// What is left goes through the usual calls, in order, so that the error is always the one of the first element that fails.
+	for (size_t i = 0; i < blocks; ++i)
+	{
+		double* first = values + i * BLOCK_SIZE;
+		size_t size = count - i * BLOCK_SIZE < BLOCK_SIZE ? count - i * BLOCK_SIZE : BLOCK_SIZE;
+
+		for (size_t j = done[i]; j < functions.size(); ++j)
+		{
+			if (j > done[i] && apply_column(functions[j], { first }, size, first))
+			{
+				continue;
+			}
+
+			for (size_t k = 0; k < size; ++k)
+			{
+				m_results.push(first[k]);
+
+				if (!call_user(functions[j], 1, out) || !pop_number(first[k], out))
+				{
+					return false;
+				}
+			}
+		}
+	}
+
+	return true;
+}
+
+bool Interpreter::apply_column(const User_Function* function, const std::vector<const double*>& arguments, size_t count, double* results) const
+{
+	std::vector<const User_Function*> callees;
+
+	// Lists and the like are left to the usual calls.
+	if (!Jit::collect(function, m_user_functions, callees) || Jit::arity(function->m_definition) > arguments.size())
+	{
+		return false;
+	}
+
+	std::vector<double> column(count);
+
+	// A chain of calls longer than there are functions means a recursion, which the native code does better.
+	if (!evaluate_column(function->m_definition, arguments, count, column.data(), is_native(function) ? callees.size() : MAX_COLUMN_DEPTH))
+	{
+		return false;
+	}
+
+	std::copy(column.begin(), column.end(), results);
+	return true;
+}
+
+bool Interpreter::apply_native(const User_Function* function, const std::vector<const double*>& arguments, size_t count, double* results) const
+{
+	if (arguments.size() > Jit::MAX_ARITY || m_numbers != Numbers::DOUBLE)
+	{
+		return false;
+	}
+
+	std::vector<double> column(count);
+	double row[Jit::MAX_ARITY];
+	std::unordered_map<const User_Function*, const thisfunc_symbol*>::const_iterator it = m_library_functions.find(function);
+	const Jit_Function* native = m_jit_enabled ? function->m_native.load(std::memory_order_acquire) : nullptr;
+
+	if (it != m_library_functions.end() ? it->second->arity != arguments.size() : !native || native->m_arity != arguments.size())
+	{
+		return false;
+	}
+
+	for (size_t i = 0; i < count; ++i)
+	{
+		for (size_t j = 0; j < arguments.size(); ++j)
+		{
+			row[j] = arguments[j][i];
+		}
+
+		if (it != m_library_functions.end() ? it->second->call(row, &column[i]) != 0 : Jit::call(native, row, column[i]) != Jit_Failure::NONE)
+		{
+			return false;
+		}
+	}
+
+	std::copy(column.begin(), column.end(), results);
+	return true;
+}
+
+bool Interpreter::evaluate_column(const Node* node, const std::vector<const double*>& arguments, size_t count, double* result, size_t depth) const
+{
+	const Factor_Node* f_ptr = dynamic_cast<const Factor_Node*>(node);
+
+	if (f_ptr)
+	{
+		std::fill(result, result + count, narrow(dynamic_cast<const Number_Token*>(f_ptr->m_token)->m_value));
+		return true;
+	}
+
+	const Argument_Node* a_ptr = dynamic_cast<const Argument_Node*>(node);
+
+	if (a_ptr)
+	{
+		size_t index = dynamic_cast<const Argument_Token*>(a_ptr->m_token)->m_value;
+
+		if (index >= arguments.size())
+		{
+			return false;
+		}
+
+		std::copy(arguments[index], arguments[index] + count, result);
+		return true;
+	}
+
+	const Unary_Operation_Node* u_ptr = dynamic_cast<const Unary_Operation_Node*>(node);
+
+	if (u_ptr)
+	{
+		const std::string& name = dynamic_cast<const Function_Token*>(u_ptr->m_token)->m_name;
+
+		if (!evaluate_column(u_ptr->m_argument, arguments, count, result, depth))
+		{
+			return false;
+		}
+
+		if (!is_unary_builtin(name))
+		{
+			std::vector<double> argument(result, result + count);
+			return call_column(name, { argument.data() }, count, result, depth);
+		}
+
+		unary(name, result, result, count);
+		return true;
+	}
+
+	const Binary_Operation_Node* b_ptr = dynamic_cast<const Binary_Operation_Node*>(node);
+
+	if (b_ptr)
+	{
+		const std::string& name = dynamic_cast<const Function_Token*>(b_ptr->m_token)->m_name;
+		std::vector<double> right(count);
+
+		if (!evaluate_column(b_ptr->m_left, arguments, count, result, depth) || !evaluate_column(b_ptr->m_right, arguments, count, right.data(), depth))
+		{
+			return false;
+		}
+
+		if (!is_binary_builtin(name))
+		{
+			std::vector<double> left(result, result + count);
+			return call_column(name, { left.data(), right.data() }, count, result, depth);
+		}
+
+		// A division by 0 gets reported when the rows are redone one at a time.
+		return combine(name, result, right.data(), count);
+	}
+
+	const If_Opeation_Node* i_ptr = dynamic_cast<const If_Opeation_Node*>(node);
+
+	if (i_ptr)
+	{
+		std::vector<double> check(count);
+
+		if (!evaluate_column(i_ptr->m_check, arguments, count, check.data(), depth))
+		{
+			return false;
+		}
+
+		// The selection vectors of the rows that take either branch.
+		std::vector<size_t> rows[2];
+
+		for (size_t i = 0; i < count; ++i)
+		{
+			rows[check[i] != 0].push_back(i);
+		}
+
+		const Node* branches[2] = { i_ptr->m_right, i_ptr->m_left };
+
+		for (int j = 0; j < 2; ++j)
+		{
+			if (rows[j].size() == count)
+			{
+				return evaluate_column(branches[j], arguments, count, result, depth);
+			}
+		}
+
+		// Each branch only gets the rows that take it, so that a recursion ends where it should.
+		for (int j = 0; j < 2; ++j)
+		{
+			size_t size = rows[j].size();
+			std::vector<double> gathered(arguments.size() * size);
+			std::vector<const double*> columns(arguments.size());
+			std::vector<double> results(size);
+
+			for (size_t k = 0; k < arguments.size(); ++k)
+			{
+				columns[k] = gathered.data() + k * size;
+
+				for (size_t i = 0; i < size; ++i)
+				{
+					gathered[k * size + i] = arguments[k][rows[j][i]];
+				}
+			}
+
+			if (!evaluate_column(branches[j], columns, size, results.data(), depth))
+			{
+				return false;
+			}
+
+			for (size_t i = 0; i < size; ++i)
+			{
+				result[rows[j][i]] = results[i];
+			}
+		}
+
+		return true;
+	}
+
+	const User_Function* u_f_ptr = dynamic_cast<const User_Function*>(node);
+
+	if (u_f_ptr)
+	{
+		std::vector<double> columns(u_f_ptr->m_arguments.size() * count);
+		std::vector<const double*> callee_arguments;
+
+		for (size_t k = 0; k < u_f_ptr->m_arguments.size(); ++k)
+		{
+			callee_arguments.push_back(columns.data() + k * count);
+
+			if (!evaluate_column(u_f_ptr->m_arguments[k], arguments, count, columns.data() + k * count, depth))
+			{
+				return false;
+			}
+		}
+
+		return call_column(dynamic_cast<const Function_Token*>(u_f_ptr->m_token)->m_name, callee_arguments, count, result, depth);
+	}
+
+	return false;
+}
+
+void Interpreter::unary(const std::string& name, const double* input, double* output, size_t count) const
+{
+	if (name == "sqrt")
+	{
+		vector_sqrt(input, output, count);
+	}
+	else if (name == "sin")
+	{
+		vector_sin(input, output, count, m_accuracy);
+	}
+	else // The only one left is cos.
+	{
+		vector_cos(input, output, count, m_accuracy);
+	}
+
+	narrow(output, count);
+}
+
+void Interpreter::unary(const std::string& name, const float* input, float* output, size_t count) const
+{
+	if (name == "sqrt")
+	{
+		vector_sqrt(input, output, count);
+	}
+	else if (name == "sin")
+	{
+		vector_sin(input, output, count, m_accuracy);
+	}
+	else
+	{
+		vector_cos(input, output, count, m_accuracy);
+	}
+}
+
+bool Interpreter::combine(const std::string& name, double* left, const double* right, size_t count) const
+{
+	if (name == "pow")
+	{
+		vector_pow(left, right, left, count, m_accuracy);
+		narrow(left, count);
+		return true;
+	}
+
+	// The loops are simple enough for the compiler to vectorize.
+	if (name == "add")
+	{
+		for (size_t i = 0; i < count; ++i) left[i] += right[i];
+	}
+	else if (name == "sub")
+	{
+		for (size_t i = 0; i < count; ++i) left[i] -= right[i];
+	}
+	else if (name == "mul")
+	{
+		for (size_t i = 0; i < count; ++i) left[i] *= right[i];
+	}
+	else if (name == "div")
+	{
+		if (std::find(right, right + count, 0.0) != right + count)
+		{
+			return false;
+		}
+
+		for (size_t i = 0; i < count; ++i) left[i] /= right[i];
+	}
+	else if (name == "eq")
+	{
+		for (size_t i = 0; i < count; ++i) left[i] = left[i] == right[i];
+	}
+	else if (name == "le")
+	{
+		for (size_t i = 0; i < count; ++i) left[i] = left[i] < right[i];
+	}
+	else // The only one left is nand.
+	{
+		for (size_t i = 0; i < count; ++i) left[i] = !left[i] || !right[i];
+	}
+
+	narrow(left, count);
+	return true;
+}
+
+bool Interpreter::call_column(const std::string& name, const std::vector<const double*>& arguments, size_t count, double* result, size_t depth) const
+{
+	const User_Function* function = find_function(name);
+
+	return function && depth > 0 && evaluate_column(function->m_definition, arguments, count, result, depth - 1);
+}
+
+bool Interpreter::print_sequence(const Sequence_Value& sequence, std::ostream& out)
+{
+	// Enough elements at once for every thread to get a block.
+	std::vector<double> block(sequence.m_count < BLOCK_SIZE * m_pool.size() ? sequence.m_count : BLOCK_SIZE * m_pool.size());
+
+	m_writer.write('[');
+
+	for (size_t i = 0; i < sequence.m_count; i += block.size())
+	{
+		size_t count = sequence.m_count - i < block.size() ? sequence.m_count - i : block.size();
+
+		// An error goes straight to the stream, after the elements before it.
+		m_writer.flush();
+
+		if (!elements(sequence, i, count, block.data(), out))
+		{
+			return false;
+		}
+
+		for (size_t j = 0; j < count; ++j)
+		{
+			if (i + j > 0)
+			{
+				m_writer.write(", ");
+			}
+
+			m_writer.write(block[j]);
+		}
+	}
+
+	m_writer.write(']');
+	return true;
+}
+
+bool Interpreter::arithmetic(const std::string& name, size_t count, std::ostream& out)
+{
+	switch (m_numbers)
+	{
+	case Numbers::INT64:
+		return arithmetic<int64_t>(name, count, out);
+	case Numbers::FLOAT32:
+		return arithmetic<float>(name, count, out);
+	default:
+		return arithmetic<double>(name, count, out);
+	}
+}
+
+template<class T>
+bool Interpreter::arithmetic(const std::string& name, size_t count, std::ostream& out)
+{
+	size_t top = m_results.size() - 1;
+
+	for (size_t i = 0; i < count; ++i)
+	{
+		if (!m_results[top - i].is_number())
+		{
+			Runtime_Error("Expected a number").print(out);
+			return false;
+		}
+	}
+
+	T result;
+	const char* error = count == 1 ? Arithmetic<T>::unary(name, number_of<T>(m_results[top]), result)
+		: Arithmetic<T>::binary(name, number_of<T>(m_results[top - 1]), number_of<T>(m_results[top]), result);
+
+	if (error)
+	{
+		Runtime_Error(error).print(out);
+		return false;
+	}
+
+	m_results.truncate(m_results.size() - count);
+	m_results.push(value_of(result));
+	return true;
+}
+
+bool Interpreter::is_zero(const Value& value) const
+{
+	return value.is_number() && (m_numbers == Numbers::INT64 ? value.integer() == 0 : value.number() == 0);
+}
+
+Value Interpreter::truth(bool value) const
+{
+	return m_numbers == Numbers::INT64 ? Value((int64_t)value) : Value(value ? 1.0 : 0.0);
+}
+
+double Interpreter::narrow(double value) const
+{
+	return m_numbers == Numbers::FLOAT32 ? (double)(float)value : value;
+}
+
+void Interpreter::narrow(double* values, size_t count) const
+{
+	if (m_numbers == Numbers::FLOAT32)
+	{
+		for (size_t i = 0; i < count; ++i) values[i] = (float)values[i];
+	}
+}
+
+Value Interpreter::list_of(std::vector<double>&& elements) const
+{
+	if (m_numbers == Numbers::FLOAT32)
+	{
+		return Value(std::vector<float>(elements.begin(), elements.end()));
+	}
+
+	return Value(std::move(elements));
+}
+
+bool Interpreter::pop_number(double& value, std::ostream& out)
+{
+	if (!m_results.top().is_number())
+	{
+		m_results.pop();
+		Runtime_Error("Expected a number").print(out);
+		return false;
+	}
+
+	value = m_results.pop().number();
+	return true;
+}
+
+bool Interpreter::pop_list(Value& list, std::ostream& out)
+{
+	list = m_results.pop();
+
+	const Sequence_Value* sequence = list.sequence();
+
+	if (sequence)
+	{
+		if (sequence->m_count == Sequence_Value::ENDLESS)
+		{
+			Runtime_Error("Expected a list that ends").print(out);
+			return false;
+		}
+
+		std::vector<double> values(sequence->m_count);
+
+		if (!elements(*sequence, 0, values.size(), values.data(), out))
+		{
+			return false;
+		}
+
+		list = list_of(std::move(values));
+	}
+
+	if (!list.is_list())
+	{
+		Runtime_Error("Expected a list").print(out);
+		return false;
+	}
+
+	return true;
+}
+
+bool Interpreter::pop_lists(std::vector<Value>& lists, std::ostream& out)
+{
+	for (size_t i = lists.size(); i-- > 0;)
+	{
+		if (!pop_list(lists[i], out))
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+bool Interpreter::visit_user(const User_Function* node, std::ostream& out)
+{
+	for (const Node* a : m_user_functions)
+	{
+		const User_Function* current_ptr = dynamic_cast<const User_Function*>(a);
+
+		if (current_ptr)
+		{
+			const Function_Token* current_name = dynamic_cast<const Function_Token*>(current_ptr->m_token);
+
+			if (current_name->m_name == dynamic_cast<const Function_Token*>(node->m_token)->m_name)
+			{
+				if (node->m_definition)
+				{
+					Runtime_Error("A function with the same name already exists").print(out);
+					return false;
+				}
+
+				if (node->m_arguments.size() == 0)
+				{
+					return visit(current_ptr->m_definition, out);
+				}
+
+				for (const Node* a : node->m_arguments)
+				{
+					if (!(m_lazy ? delay(a, out) : visit(a, out)))
+					{
+						return false;
+					}
+				}
+
+				return call_user(current_ptr, node->m_arguments.size(), out);
+			}
+		}
+	}
+
+	if (!node->m_definition)
+	{
+		Runtime_Error("Expected \"<-\"").print(out);
+		return false;
+	}
+
+	const Function_Token* function_name = dynamic_cast<const Function_Token*>(node->m_token);
+	const Function_Token* its_definition = dynamic_cast<const Function_Token*>(node->m_definition->m_token);
+
+	if(function_name && its_definition && function_name->m_name == its_definition->m_name)
+	{
+		Runtime_Error("Function will cause stack overflow and hence will not be created").print(out);
+		return false;
+	}
+
+	add_function(node);
+	retry_unsupported();
+	return true;
+}
+
+void Interpreter::add_function(const User_Function* node)
+{
+	m_user_functions.push_back(node);
+
+	if (m_memoization == Memoization::ALL ? Jit::arity(node->m_definition) > 0
+		: m_memoization == Memoization::RECURSIVE && calls_to(node->m_definition, dynamic_cast<const Function_Token*>(node->m_token)->m_name) > 1)
+	{
+		node->m_tier = Tier::MEMOIZED;
+		m_memos[node] = new Memo(m_memo_size, m_eviction);
+	}
+}
+
+void Interpreter::retry_unsupported()
+{
+	for (const Node* a : m_user_functions)
+	{
+		const User_Function* current_ptr = dynamic_cast<const User_Function*>(a);
+
+		if (current_ptr && current_ptr->m_tier == Tier::UNSUPPORTED)
+		{
+			current_ptr->m_tier = Tier::INTERPRETED;
+		}
+	}
+}
+
+bool Interpreter::delay(const Node* node, std::ostream& out)
+{
+	const Argument_Node* a_ptr = dynamic_cast<const Argument_Node*>(node);
+	const Argument_Token* a_token = a_ptr ? dynamic_cast<const Argument_Token*>(a_ptr->m_token) : nullptr;
+
+	// Passing on an argument shares its thunk, so it still gets evaluated at most once.
+	if (a_token && a_token->m_value < m_arity)
+	{
+		Value value = m_results[m_base + a_token->m_value]; // The push may move the stack.
+		Thunk_Value* thunk = value.thunk();
+
+		if (thunk && thunk->m_forced)
+		{
+			value = thunk->m_value;
+		}
+
+		m_results.push(std::move(value));
+		return true;
+	}
+
+	// A number costs less than its thunk.
+	if (dynamic_cast<const Factor_Node*>(node))
+	{
+		return visit(node, out);
+	}
+
+	m_results.push(Value(new Thunk_Value(node, m_base, m_arity, m_current)));
+	return true;
+}
+
+bool Interpreter::force(Thunk_Value* thunk, std::ostream& out)
+{
+	if (thunk->m_forced)
+	{
+		return true;
+	}
+
+	size_t base = m_base;
+	size_t arity = m_arity;
+	const User_Function* current = m_current;
+
+	m_base = thunk->m_base;
+	m_arity = thunk->m_arity;
+	m_current = thunk->m_function;
+
+	bool b = evaluate(thunk->m_node, out);
+
+	m_base = base;
+	m_arity = arity;
+	m_current = current;
+
+	if (!b)
+	{
+		return false;
+	}
+
+	thunk->m_value = m_results.pop();
+	thunk->m_forced = true;
+	return true;
+}
+
+bool Interpreter::evaluate(const Node* ast, std::ostream& out)
+{
+	if (!m_explicit_stack)
+	{
+		return visit(ast, out);
+	}
+
+	// The functions that map and the like call get evaluated through here as well, so this may be nested.
+	// Each level stops at its own bottom.
+	if (m_nesting == MAX_NESTING)
+	{
+		Runtime_Error("Stack limit exceeded").print(out);
+		return false;
+	}
+
+	size_t bottom = m_continuations.size();
+	bool b = true;
+
+	m_continuations.push_back({ ast, 0 });
+	++m_nesting;
+
+	while (b && m_continuations.size() > bottom)
+	{
+		if (m_continuations.size() + m_frames.size() > m_stack_limit)
+		{
+			Runtime_Error("Stack limit exceeded").print(out);
+			b = false;
+		}
+		else
+		{
+			b = step(out);
+		}
+	}
+
+	--m_nesting;
+	return b;
+}
+
+bool Interpreter::step(std::ostream& out)
+{
+	size_t top = m_continuations.size() - 1;
+	const Node* node = m_continuations[top].m_node;
+	size_t stage = m_continuations[top].m_stage++; // The pushes below may move the vector so no references to it.
+
+	if (!node && m_continuations[top].m_thunk) // Done forcing the thunk. Its value stays as the one of the argument.
+	{
+		Thunk_Value* thunk = m_continuations[top].m_thunk;
+
+		m_continuations.pop_back();
+
+		thunk->m_value = m_results[m_results.size() - 1];
+		thunk->m_forced = true;
+
+		m_base = m_frames.back().m_base;
+		m_arity = m_frames.back().m_arity;
+		m_current = m_frames.back().m_caller;
+
+		m_frames.pop_back();
+		return true;
+	}
+
+	if (!node) // Returning from a user function.
+	{
+		m_continuations.pop_back();
+
+		remember(m_current, m_base, m_arity);
+		leave(m_base, m_arity);
+
+		m_base = m_frames.back().m_base;
+		m_arity = m_frames.back().m_arity;
+		m_current = m_frames.back().m_caller;
+
+		m_frames.pop_back();
+		return true;
+	}
+
+	const Factor_Node* f_ptr = dynamic_cast<const Factor_Node*>(node);
+
+	if (f_ptr)
+	{
+		m_continuations.pop_back();
+		return visit_factor(f_ptr, out);
+	}
+
+	const Argument_Node* a_ptr = dynamic_cast<const Argument_Node*>(node);
+
+	if (a_ptr)
+	{
+		const Argument_Token* a_token = dynamic_cast<const Argument_Token*>(a_ptr->m_token);
+		Thunk_Value* thunk = a_token && a_token->m_value < m_arity ? m_results[m_base + a_token->m_value].thunk() : nullptr;
+
+		// A thunk gets evaluated on the stack as well, in the frame of the caller, instead of recursing through force.
+		if (thunk && !thunk->m_forced)
+		{
+			m_frames.push_back({ m_base, m_arity, m_current });
+
+			m_base = thunk->m_base;
+			m_arity = thunk->m_arity;
+			m_current = thunk->m_function;
+
+			m_continuations[top] = { nullptr, 0, thunk };
+			m_continuations.push_back({ thunk->m_node, 0 });
+			return true;
+		}
+
+		m_continuations.pop_back();
+		return visit_argument(a_ptr, out);
+	}
+
+	const Unary_Operation_Node* u_ptr = dynamic_cast<const Unary_Operation_Node*>(node);
+
+	if (u_ptr)
+	{
+		const std::string& name = dynamic_cast<const Function_Token*>(u_ptr->m_token)->m_name;
+
+		if (name == "load")
+		{
+			m_continuations.pop_back();
+			return visit_file_function(u_ptr, out);
+		}
+
+		if (m_lazy && !is_unary_builtin(name) && !is_list_builtin(name))
+		{
+			m_continuations.pop_back();
+			return delay(u_ptr->m_argument, out) && call(name, 1, out);
+		}
+
+		if (stage == 0)
+		{
+			m_continuations.push_back({ u_ptr->m_argument, 0 });
+			return true;
+		}
+
+		m_continuations.pop_back();
+
+		return is_unary_builtin(name) || is_list_builtin(name) ? visit_unary(u_ptr, out) : call(name, 1, out);
+	}
+
+	const Binary_Operation_Node* b_ptr = dynamic_cast<const Binary_Operation_Node*>(node);
+
+	if (b_ptr)
+	{
+		const std::string& name = dynamic_cast<const Function_Token*>(b_ptr->m_token)->m_name;
+
+		if (is_list_builtin(name))
+		{
+			return step_operands(b_ptr, stage, out);
+		}
+
+		if (m_lazy && !is_binary_builtin(name))
+		{
+			m_continuations.pop_back();
+			return delay(b_ptr->m_left, out) && delay(b_ptr->m_right, out) && call(name, 2, out);
+		}
+
+		// nand is 1 as soon as its left side is 0.
+		if (stage == 1 && m_lazy && name == "nand" && is_zero(m_results[m_results.size() - 1]))
+		{
+			m_continuations.pop_back();
+			m_results.pop();
+			m_results.push(truth(true));
+			return true;
+		}
+
+		if (stage < 2)
+		{
+			m_continuations.push_back({ stage == 0 ? b_ptr->m_left : b_ptr->m_right, 0 });
+			return true;
+		}
+
+		m_continuations.pop_back();
+
+		return is_binary_builtin(name) ? visit_binary(b_ptr, out) : call(name, 2, out);
+	}
+
+	const If_Opeation_Node* i_ptr = dynamic_cast<const If_Opeation_Node*>(node);
+
+	if (i_ptr)
+	{
+		if (stage == 0)
+		{
+			m_continuations.push_back({ i_ptr->m_check, 0 });
+			return true;
+		}
+
+		double check;
+
+		if (!pop_number(check, out))
+		{
+			return false;
+		}
+
+		// The chosen branch takes the place of the if.
+		m_continuations[top] = { is_zero(check) ? i_ptr->m_right : i_ptr->m_left, 0 };
+		return true;
+	}
+
+	const User_Function* u_f_ptr = dynamic_cast<const User_Function*>(node);
+
+	if (u_f_ptr)
+	{
+		if (is_axpy(u_f_ptr))
+		{
+			return step_operands(u_f_ptr, stage, out);
+		}
+
+		if (u_f_ptr->m_definition)
+		{
+			m_continuations.pop_back();
+			return visit_user(u_f_ptr, out);
+		}
+
+		if (stage == 0 && !find_function(dynamic_cast<const Function_Token*>(u_f_ptr->m_token)->m_name))
+		{
+			Runtime_Error("Expected \"<-\"").print(out);
+			return false;
+		}
+
+		const std::string& name = dynamic_cast<const Function_Token*>(u_f_ptr->m_token)->m_name;
+
+		if (m_lazy && u_f_ptr->m_arguments.size() > 0)
+		{
+			m_continuations.pop_back();
+
+			for (const Node* a : u_f_ptr->m_arguments)
+			{
+				if (!delay(a, out))
+				{
+					return false;
+				}
+			}
+
+			return call(name, u_f_ptr->m_arguments.size(), out);
+		}
+
+		if (stage < u_f_ptr->m_arguments.size())
+		{
+			m_continuations.push_back({ u_f_ptr->m_arguments[stage], 0 });
+			return true;
+		}
+
+		if (u_f_ptr->m_arguments.size() == 0)
+		{
+			m_continuations[top] = { find_function(name)->m_definition, 0 };
+			return true;
+		}
+
+		m_continuations.pop_back();
+		return call(name, u_f_ptr->m_arguments.size(), out);
+	}
+
+	// The rest are lists, maps and the like.
+	return step_operands(node, stage, out);
+}
+
+bool Interpreter::step_operands(const Node* node, size_t stage, std::ostream& out)
+{
+	const Node* next = operand(node, stage);
+
+	if (next)
+	{
+		m_continuations.push_back({ next, 0 });
+		return true;
+	}
+
+	m_continuations.pop_back();
+	return visit_evaluated(node, out);
+}
+
+bool Interpreter::call(const std::string& name, size_t count, std::ostream& out)
+{
+	const User_Function* function = find_function(name);
+
+	if (!function)
+	{
+		Runtime_Error("No matching function definition found").print(out);
+		return false;
+	}
+
+	size_t base = m_results.size() - count;
+
+	if (recall(function, base, count) || call_native(function, base, count))
+	{
+		return true;
+	}
+
+	m_frames.push_back({ m_base, m_arity, m_current });
+
+	m_base = base;
+	m_arity = count;
+	m_current = function;
+
+	m_continuations.push_back({ nullptr, 0 });
+	m_continuations.push_back({ function->m_definition, 0 });
+	return true;
+}
+
+const User_Function* Interpreter::find_function(const std::string& name) const
+{
+	for (const Node* a : m_user_functions)
+	{
+		const User_Function* current_ptr = dynamic_cast<const User_Function*>(a);
+
+		if (current_ptr && dynamic_cast<const Function_Token*>(current_ptr->m_token)->m_name == name)
+		{
+			return current_ptr;
+		}
+	}
+
+	return nullptr;
+}
+
+bool Interpreter::call_user(const std::string& name, size_t count, std::ostream& out)
+{
+	const User_Function* function = find_function(name);
+
+	if (!function)
+	{
+		Runtime_Error("No matching function definition found").print(out);
+		return false;
+	}
+
+	return call_user(function, count, out);
+}
+
+bool Interpreter::call_user(const User_Function* function, size_t count, std::ostream& out)
+{
+	size_t base = m_results.size() - count;
+
+	if (recall(function, base, count) || call_native(function, base, count))
+	{
+		return true;
+	}
+
+	size_t caller_base = m_base;
+	size_t caller_arity = m_arity;
+	const User_Function* caller = m_current;
+
+	m_base = base;
+	m_arity = count;
+	m_current = function;
+
+	bool b = evaluate(function->m_definition, out);
+
+	m_base = caller_base;
+	m_arity = caller_arity;
+	m_current = caller;
+
+	if (b)
+	{
+		remember(function, base, count);
+		leave(base, count);
+	}
+
+	return b;
+}
+
+void Interpreter::leave(size_t base, size_t count)
+{
+	if (m_results.size() > base + count)
+	{
+		Value result = m_results.pop();
+		m_results.truncate(base);
+		m_results.push(std::move(result));
+	}
+	else // The definition did not leave a value (e.g. it defined a function).
+	{
+		m_results.truncate(base);
+	}
+}
+
+Memo* Interpreter::memo_of(const User_Function* function, size_t base, size_t count, double* arguments)
+{
+	if (m_memos.empty() || count > Memo::MAX_ARITY)
+	{
+		return nullptr;
+	}
+
+	std::unordered_map<const User_Function*, Memo*>::const_iterator it = m_memos.find(function);
+
+	if (it == m_memos.end())
+	{
+		return nullptr;
+	}
+
+	// Thunks and lists are not kept.
+	for (size_t i = 0; i < count; ++i)
+	{
+		if (!m_results[base + i].is_number())
+		{
+			return nullptr;
+		}
+
+		arguments[i] = m_results[base + i].number();
+	}
+
+	return it->second;
+}
+
+bool Interpreter::recall(const User_Function* function, size_t base, size_t count)
+{
+	double arguments[Memo::MAX_ARITY];
+	double result;
+	Memo* memo = memo_of(function, base, count, arguments);
+
+	uint64_t hash;
+
+	if (!memo)
+	{
+		return false;
+	}
+
+	// The file is shared, so what it has goes into the table as well.
+	if (!memo->find(arguments, count, result))
+	{
+		if (!memo_file().is_open() || !definition_hash(function, hash) || !memo_file().find(hash, arguments, count, result))
+		{
+			return false;
+		}
+
+		memo->insert(arguments, count, result);
+	}
+
+	m_results.truncate(base);
+	m_results.push(result);
+	return true;
+}
+
+void Interpreter::remember(const User_Function* function, size_t base, size_t count)
+{
+	double arguments[Memo::MAX_ARITY];
+	Memo* memo = memo_of(function, base, count, arguments);
+	// The definition may not have left a value (e.g. it defined a function).
+	if (memo && m_results.size() > base + count && m_results[m_results.size() - 1].is_number())
+	{
+		double result = m_results[m_results.size() - 1].number();
+		uint64_t hash;
+
+		memo->insert(arguments, count, result);
+
+		if (memo_file().is_open() && definition_hash(function, hash))
+		{
+			memo_file().insert(hash, arguments, count, result);
+		}
+	}
+}
+
+Memo_File& Interpreter::memo_file()
+{
+	return m_parent ? m_parent->m_memo_file : m_memo_file;
+}
+
+bool Interpreter::definition_hash(const User_Function* function, uint64_t& hash)
+{
+	std::unordered_map<const User_Function*, uint64_t>::const_iterator it = m_definition_hashes.find(function);
+
+	if (it != m_definition_hashes.end())
+	{
+		hash = it->second;
+		return true;
+	}
+
+	std::vector<const User_Function*> functions = { function };
+	std::string text;
+
+	// The same definitions give other results (integers are even kept as their bits) in other numbers, with the fast
+	// kernels or with the other sum, so those belong to the hash as well.
+	text += (char)m_numbers;
+	text += (char)m_accuracy;
+	text += (char)m_summation;
+
+	// The functions it calls get appended as they are reached, so the order is always the same.
+	for (size_t i = 0; i < functions.size(); ++i)
+	{
+		std::vector<std::string> names;
+
+		text += dynamic_cast<const Function_Token*>(functions[i]->m_token)->m_name;
+		describe(functions[i]->m_definition, text, names);
+		text += '\n';
+
+		for (const std::string& a : names)
+		{
+			// What a file holds may change from one run to the next.
+			if (is_file_builtin(a))
+			{
+				return false;
+			}
+
+			if (is_unary_builtin(a) || is_binary_builtin(a) || is_list_builtin(a) || a == "if" || a == "list" || a == "map"
+				|| a == "reduce" || a == "foldl" || a == "filter" || a == "zipWith")
+			{
+				continue;
+			}
+
+			const User_Function* callee = find_function(a);
+
+			if (!callee)
+			{
+				return false;
+			}
+
+			if (std::find(functions.begin(), functions.end(), callee) == functions.end())
+			{
+				functions.push_back(callee);
+			}
+		}
+	}
+
+	// FNV-1a.
+	hash = 0xCBF29CE484222325;
+
+	for (char a : text)
+	{
+		hash = (hash ^ (unsigned char)a) * 0x100000001B3;
+	}
+
+	m_definition_hashes[function] = hash;
+	return true;
+}
+
+bool Interpreter::open_memo_file(const std::string& path, std::ostream& out)
+{
+	if (!m_memo_file.open(path))
+	{
+		Error("Memo file error", "\"" + path + "\" cannot be opened or is not a memo file").print(out);
+		return false;
+	}
+
+	if (m_memoization == Memoization::OFF)
+	{
+		m_memoization = Memoization::RECURSIVE;
+	}
+
+	return true;
+}
+
+bool Interpreter::call_native(const User_Function* function, size_t base, size_t count)
+{
+	if (count > Jit::MAX_ARITY)
+	{
+		return false;
+	}
+
+	// Native code only takes numbers.
+	double arguments[Jit::MAX_ARITY];
+	double result;
+
+	for (size_t i = 0; i < count; ++i)
+	{
+		if (!m_results[base + i].is_number())
+		{
+			return false;
+		}
+
+		arguments[i] = m_results[base + i].number();
+	}
+
+	if (!call_native(function, arguments, count, result))
+	{
+		return false;
+	}
+
+	m_results.truncate(base);
+	m_results.push(result);
+	return true;
+}
+
+bool Interpreter::call_native(const User_Function* function, const double* arguments, size_t count, double& result)
+{
+	// The native code computes in double. Once it has run out of stack, the calls nested in that one are interpreted,
+	// or every level of a deep recursion would go down to the limit again before falling back.
+	if (m_numbers != Numbers::DOUBLE || m_native_overflowed)
+	{
+		return false;
+	}
+
+	std::unordered_map<const User_Function*, const thisfunc_symbol*>::const_iterator it = m_library_functions.find(function);
+
+	if (it != m_library_functions.end())
+	{
+		if (it->second->arity != count)
+		{
+			return false;
+		}
+
+		int status = it->second->call(arguments, &result);
+		m_native_overflowed = status == 2;
+		return status == 0;
+	}
+
+	if (!m_jit_enabled)
+	{
+		return false;
+	}
+
+	const Jit_Function* native = function->m_native.load(std::memory_order_acquire);
+
+	if (native)
+	{
+		if (native->m_arity != count)
+		{
+			return false;
+		}
+
+		Jit_Failure failure = Jit::call(native, arguments, result);
+		m_native_overflowed = failure == Jit_Failure::STACK;
+		return failure == Jit_Failure::NONE;
+	}
+
+	count_calls(function, 1);
+	return false;
+}
+
+bool Interpreter::is_native(const User_Function* function) const
+{
+	return m_numbers == Numbers::DOUBLE
+		&& (m_library_functions.count(function) > 0 || (m_jit_enabled && function->m_native.load(std::memory_order_acquire)));
+}
+
+void Interpreter::count_calls(const User_Function* function, size_t calls)
+{
+	if (!m_jit_enabled || m_numbers != Numbers::DOUBLE)
+	{
+		return;
+	}
+
+	size_t total = function->m_calls += calls;
+	size_t recursive_calls = function == m_current ? function->m_recursive_calls += calls : function->m_recursive_calls.load();
+
+	// The back-edges count twice since that is where recursive functions spend their time.
+	Tier interpreted = Tier::INTERPRETED;
+
+	// The workers of a parallel batch share the functions, so only the first one to get there queues it,
+	// with the JIT of the parent, which keeps the code for as long as the functions live.
+	if ((recursive_calls >= m_tier_threshold || total >= m_tier_threshold - recursive_calls) && function->m_tier.compare_exchange_strong(interpreted, Tier::QUEUED))
+	{
+		(m_parent ? m_parent->m_jit : m_jit).request(function, m_user_functions);
+	}
+}
+
+Interpreter::Interpreter()
+	: m_results(INITIAL_STACK_SIZE),
+	m_base(0),
+	m_arity(0),
+	m_current(nullptr),
+	m_jit_enabled(true),
+	m_tier_threshold(DEFAULT_TIER_THRESHOLD),
+	m_lazy(false),
+	m_explicit_stack(false),
+	m_stack_limit(DEFAULT_STACK_LIMIT),
+	m_nesting(0),
+	m_native_overflowed(false),
+	m_accuracy(Accuracy::EXACT),
+	m_summation(Summation::PAIRWISE),
+	m_parallel_threshold(DEFAULT_PARALLEL_THRESHOLD),
+	m_memoization(Memoization::OFF),
+	m_memo_size(DEFAULT_MEMO_SIZE),
+	m_eviction(Eviction::LRU),
+	m_numbers(Numbers::DOUBLE),
+	m_parent(nullptr)
+{ }
+
+Interpreter::Interpreter(Interpreter* parent)
+	: m_results(INITIAL_STACK_SIZE),
+	m_base(0),
+	m_arity(0),
+	m_current(nullptr),
+	m_jit_enabled(parent->m_jit_enabled),
+	m_tier_threshold(parent->m_tier_threshold),
+	m_lazy(parent->m_lazy),
+	m_explicit_stack(parent->m_explicit_stack),
+	m_stack_limit(parent->m_stack_limit),
+	m_nesting(0),
+	m_native_overflowed(false),
+	m_accuracy(parent->m_accuracy),
+	m_summation(parent->m_summation),
+	m_parallel_threshold(parent->m_parallel_threshold),
+	m_memoization(parent->m_memoization),
+	m_memo_size(parent->m_memo_size),
+	m_eviction(parent->m_eviction),
+	m_numbers(parent->m_numbers),
+	m_parent(parent)
+{
+	// The statements are what runs side by side, so a map inside one of them stays on its thread.
+	m_pool.set_size(1);
+}
+
+Interpreter::~Interpreter()
+{
+	for (Interpreter* a : m_workers)
+	{
+		delete a;
+	}
+
+	m_jit.stop(); // It may be compiling one of the functions.
+
+	// The functions of a worker belong to its parent.
+	if (!m_parent)
+	{
+		for (const Node* a : m_user_functions)
+		{
+			delete a;
+			a = nullptr;
+		}
+	}
+
+	for (const std::pair<const User_Function* const, Memo*>& a : m_memos)
+	{
+		delete a.second;
+	}
+
+#ifdef THISFUNC_LIBRARIES
+	for (void* a : m_libraries)
+	{
+		dlclose(a);
+	}
+#endif
+}
+
+void Interpreter::reset()
+{
+	m_base = 0;
+	m_arity = 0;
+	m_current = nullptr;
+	m_continuations.clear();
+	m_frames.clear();
+	m_results.truncate(0);
+}
+
+bool Interpreter::interpret(const Node* ast, std::ostream& out)
+{
+	m_native_overflowed = false;
+
+	if (!evaluate(ast, out))
+	{
+		reset();
+		return false;
+	}
+
+	if (!m_results.is_empty())
+	{
+		Value result = m_results.pop();
+		const Sequence_Value* sequence = result.sequence();
+
+		m_writer.open(out);
+		m_writer.set_single_precision(m_numbers == Numbers::FLOAT32);
+
+		if (m_numbers == Numbers::INT64 && result.is_number())
+		{
+			m_writer.write(result.integer());
+		}
+		else if (!sequence)
+		{
+			result.print(m_writer);
+		}
+		else if (!print_sequence(*sequence, out))
+		{
+			reset();
+			return false;
+		}
+
+		m_writer.flush();
+	}
+
+	if (!m_results.is_empty() || m_arity != 0)
+	{
+		Runtime_Error("Unexpected argument").print(out);
+		return false;
+	}
+
+	return true;
+}
+
+bool Interpreter::interpret_parallel(const std::vector<const Node*>& expressions, std::vector<std::string>& outputs, std::vector<char>& succeeded)
+{
+	while (m_workers.size() < m_pool.size())
+	{
+		m_workers.push_back(new Interpreter(this));
+	}
+
+	for (Interpreter* a : m_workers)
+	{
+		a->follow();
+	}
+
+	// Every thread takes a worker for the expression it runs and hands it back after, so there is always one left.
+	std::vector<Interpreter*> idle(m_workers);
+	std::mutex mutex; // Guards idle.
+
+	outputs.assign(expressions.size(), std::string());
+	succeeded.assign(expressions.size(), 0);
+
+	m_pool.run(expressions.size(), [&expressions, &outputs, &succeeded, &idle, &mutex](size_t i)
+	{
+		Interpreter* worker;
+
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			worker = idle.back();
+			idle.pop_back();
+		}
+
+		std::ostringstream out;
+
+		succeeded[i] = worker->interpret(expressions[i], out);
+		outputs[i] = out.str();
+
+		std::lock_guard<std::mutex> lock(mutex);
+		idle.push_back(worker);
+	});
+
+	return std::find(succeeded.begin(), succeeded.end(), 0) == succeeded.end();
+}
+
+bool Interpreter::writes_files(const Node* ast) const
+{
+	std::vector<const Node*> nodes = { ast };
+
+	// The definitions of the functions it calls get appended as they are reached.
+	for (size_t i = 0; i < nodes.size(); ++i)
+	{
+		std::string text;
+		std::vector<std::string> names;
+
+		describe(nodes[i], text, names);
+
+		for (const std::string& a : names)
+		{
+			if (a == "save" || a == "savecsv")
+			{
+				return true;
+			}
+
+			const User_Function* callee = find_function(a);
+
+			if (callee && std::find(nodes.begin(), nodes.end(), callee->m_definition) == nodes.end())
+			{
+				nodes.push_back(callee->m_definition);
+			}
+		}
+	}
+
+	return false;
+}
+
+void Interpreter::follow()
+{
+	m_user_functions = m_parent->m_user_functions;
+	m_library_functions = m_parent->m_library_functions;
+
+	for (const std::pair<const User_Function* const, Memo*>& a : m_parent->m_memos)
+	{
+		if (!m_memos.count(a.first))
+		{
+			m_memos[a.first] = new Memo(m_memo_size, m_eviction);
+		}
+	}
+}
+
+bool Interpreter::load_library(const std::string& path, std::ostream& out)
+{
+#ifdef THISFUNC_LIBRARIES
+	void* library = dlopen(path.c_str(), RTLD_NOW | RTLD_LOCAL);
+
+	if (!library)
+	{
+		Error("Library error", dlerror()).print(out);
+		return false;
+	}
+
+	const unsigned* version = (const unsigned*)dlsym(library, "thisfunc_abi_version");
+	const unsigned* count = (const unsigned*)dlsym(library, "thisfunc_symbol_count");
+	const thisfunc_symbol* symbols = (const thisfunc_symbol*)dlsym(library, "thisfunc_symbols");
+
+	if (!version || !count || !symbols || *version != THISFUNC_ABI_VERSION)
+	{
+		Error("Library error", "\"" + path + "\" is not a compatible library").print(out);
+		dlclose(library);
+		return false;
+	}
+
+	m_libraries.push_back(library);
+
+	for (unsigned i = 0; i < *count; ++i)
+	{
+		Node* a = parse(symbols[i].source, out);
+
+		if (!a)
+		{
+			return false;
+		}
+
+		size_t size = m_user_functions.size();
+
+		interpret(a, out);
+
+		if (m_user_functions.size() == size)
+		{
+			delete a;
+			return false;
+		}
+
+		if (symbols[i].call)
+		{
+			m_library_functions[dynamic_cast<const User_Function*>(m_user_functions.back())] = &symbols[i];
+		}
+	}
+
+	return true;
+#else
+	Error("Library error", "Loading libraries is not supported on this platform").print(out);
+	return false;
+#endif
+}
+
+bool Interpreter::save_image(const std::string& path, std::ostream& out) const
+{
+	return write_image(m_user_functions, path, out);
+}
+
+bool Interpreter::load_image(const std::string& path, std::ostream& out)
+{
+	std::vector<Node*> functions;
+	std::unordered_set<std::string> names;
+
+	if (!read_image(path, functions, out))
+	{
+		return false;
+	}
+
+	for (const Node* a : m_user_functions)
+	{
+		names.insert(dynamic_cast<const Function_Token*>(a->m_token)->m_name);
+	}
+
+	// The definitions were checked when they were first made, so only their names can clash. Checking them all at once
+	// (rather than defining the functions one by one, which compares every name with all the others) keeps a big image fast.
+	for (const Node* a : functions)
+	{
+		const User_Function* function = dynamic_cast<const User_Function*>(a);
+		const Function_Token* its_definition = dynamic_cast<const Function_Token*>(function->m_definition->m_token);
+		const std::string& name = dynamic_cast<const Function_Token*>(function->m_token)->m_name;
+
+		if (!names.insert(name).second || (its_definition && its_definition->m_name == name))
+		{
+			Error("Image error", "\"" + path + "\" defines " + name + (its_definition && its_definition->m_name == name ? " as itself" : ", which already exists")).print(out);
+
+			for (Node* b : functions)
+			{
+				delete b;
+			}
+
+			return false;
+		}
+	}
+
+	for (const Node* a : functions)
+	{
+		add_function(dynamic_cast<const User_Function*>(a));
+	}
+
+	retry_unsupported();
+	return true;
+}
+
+void Interpreter::set_jit(bool enabled)
+{
+	m_jit_enabled = enabled;
+}
+
+void Interpreter::set_tier_threshold(size_t calls)
+{
+	m_tier_threshold = calls;
+}
+
+void Interpreter::set_lazy(bool enabled)
+{
+	m_lazy = enabled;
+}
+
+void Interpreter::set_explicit_stack(bool enabled)
+{
+	m_explicit_stack = enabled;
+}
+
+void Interpreter::set_stack_limit(size_t limit)
+{
+	m_stack_limit = limit;
+}
+
+void Interpreter::set_accuracy(Accuracy accuracy)
+{
+	m_accuracy = accuracy;
+}
+
+void Interpreter::set_summation(Summation summation)
+{
+	m_summation = summation;
+}
+
+void Interpreter::set_numbers(Numbers numbers)
+{
+	m_numbers = numbers;
+}
+
+void Interpreter::set_threads(size_t threads)
+{
+	m_pool.set_size(threads);
+}
+
+void Interpreter::set_parallel_threshold(size_t elements)
+{
+	m_parallel_threshold = elements;
+}
+
+void Interpreter::set_memoization(Memoization memoization)
+{
+	m_memoization = memoization;
+}
+
+void Interpreter::set_memo_size(size_t entries)
+{
+	m_memo_size = entries;
+}
+
+void Interpreter::set_eviction(Eviction eviction)
+{
+	m_eviction = eviction;
+}
+
+void Interpreter::print_memo_statistics(std::ostream& out) const
+{
+	for (const Node* a : m_user_functions)
+	{
+		const User_Function* function = dynamic_cast<const User_Function*>(a);
+
+		if (!m_memos.count(function))
+		{
+			continue;
+		}
+
+		// The workers of a parallel batch have tables of their own.
+		size_t hits = 0;
+		size_t misses = 0;
+		size_t evictions = 0;
+		size_t entries = 0;
+
+		for (const Interpreter* b : m_workers)
+		{
+			std::unordered_map<const User_Function*, Memo*>::const_iterator it = b->m_memos.find(function);
+
+			if (it != b->m_memos.end())
+			{
+				hits += it->second->hits();
+				misses += it->second->misses();
+				evictions += it->second->evictions();
+				entries += it->second->size();
+			}
+		}
+
+		const Memo* memo = m_memos.find(function)->second;
+
+		hits += memo->hits();
+		misses += memo->misses();
+		evictions += memo->evictions();
+		entries += memo->size();
+
+		size_t calls = hits + misses;
+
+		out << dynamic_cast<const Function_Token*>(a->m_token)->m_name << ": "
+			<< hits << " hits, " << misses << " misses (" << (calls > 0 ? 100.0 * hits / calls : 0) << "% hits), "
+			<< evictions << " evictions, " << entries << " entries\n";
+	}
+
+	if (m_memo_file.is_open())
+	{
+		out << "memo file: " << m_memo_file.hits() << " hits, " << m_memo_file.misses() << " misses\n";
 	}
 }
\ No newline at end of file
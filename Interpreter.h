@@ -1,23 +1,110 @@
 #pragma once
 
+#include <algorithm>
+#include <cmath>
+#include <unordered_map>
 #include "Parser.h"
 #include "Stack.hpp"
+#include "Value.h"
+#include "Number.h"
+#include "Writer.h"
+#include "Kernels.h"
+#include "Pool.h"
+#include "Memo.h"
+#include "Data.h"
+#include "Jit.h"
+#include "Aot.h"
+#include "Image.h"
+
+/// A node on the explicit stack and how far its evaluation got.
+struct Continuation
+{
+	const Node* m_node; /// nullptr marks the return from a user function, or from forcing m_thunk.
+	size_t m_stage;
+	Thunk_Value* m_thunk = nullptr;
+};
+
+/// What a call on the explicit stack has to restore when it returns.
+struct Frame
+{
+	size_t m_base; /// The frame of the caller.
+	size_t m_arity;
+	const User_Function* m_caller;
+};
+
+/// How sum and mean add up the elements.
+enum class Summation
+{
+	PAIRWISE, /// In a tree, which vectorizes. The error grows with the logarithm of the length.
+	COMPENSATED, /// Keeping track of what every addition rounds off. Slower, but the error does not grow with the length.
+};
+
+/// Which user functions keep their results.
+enum class Memoization
+{
+	OFF,
+	RECURSIVE, /// The ones that call themselves more than once, where the same calls come up over and over.
+	ALL, /// Every function with arguments.
+};
 
 class Interpreter
 {
 private:
-	Stack<double> m_results; /// Store the (intermediary) results of the visits.
+	Stack<Value> m_results; /// Store the (intermediary) results of the visits.
 							/// Predefined functions store their arguments here.
 							/// Ex: When add(5, 6) is received 5 and 6 will get stored here.
-	std::vector<double> m_arguments; /// Store the arguments of the user defined functions
-									/// Ex: When fact(9) is received, 9 will get stored here and not in the stack.
+							/// The arguments of a user function stay where they were computed and form its frame.
+							/// Ex: When fact(9) is received, 9 is the frame and the result replaces it.
+							/// Lists and sequences live here as well, as references.
 
-	int m_offset; /// Defines how much of the arguments in the vector are from a previous function call.
-				 /// Used for recursion.
+	size_t m_base; /// Where the frame of the current function call starts in the results.
+	size_t m_arity; /// How many arguments it has.
 
 	std::vector<const Node*> m_user_functions; /// Stores pointers to the user defined functions.
 											 /// Used vector for easy traversal and constant access time by index.
 
+	const User_Function* m_current; /// The function whose definition is being visited. Used to spot recursive calls.
+
+	Jit m_jit; /// Native code of the numeric user functions.
+	bool m_jit_enabled;
+	size_t m_tier_threshold; /// How many calls (recursive ones count twice) it takes before a function gets compiled.
+
+	bool m_lazy; /// Pass the arguments of user functions as thunks and let nand skip its right side when the left one decides.
+	bool m_explicit_stack; /// Evaluate with the continuations below instead of recursing.
+	size_t m_stack_limit; /// The most continuations and frames there may be at once.
+	std::vector<Continuation> m_continuations;
+	std::vector<Frame> m_frames;
+	size_t m_nesting; /// How many evaluations on the explicit stack run inside one another, e.g. when map calls its function.
+	bool m_native_overflowed; /// Native code ran out of stack during this evaluation, so the rest of it is interpreted.
+
+	Accuracy m_accuracy; /// How sin, cos and pow get computed over lists.
+	Summation m_summation;
+	Pool m_pool; /// Where map spreads the blocks of a big list.
+	size_t m_parallel_threshold; /// Shorter lists are mapped on the calling thread.
+
+	Memoization m_memoization;
+	size_t m_memo_size; /// How many results every memoized function may keep.
+	Eviction m_eviction;
+	std::unordered_map<const User_Function*, Memo*> m_memos; /// Made when the function is defined. Deleted in the destructor.
+	Memo_File m_memo_file; /// Behind the tables, if open.
+	std::unordered_map<const User_Function*, uint64_t> m_definition_hashes; /// Once every function they call is defined.
+
+	Numbers m_numbers;
+	Writer m_writer; /// Where the results get printed, a chunk at a time.
+
+	Interpreter* m_parent; /// Whose functions a worker of interpret_parallel evaluates with. nullptr otherwise.
+	std::vector<Interpreter*> m_workers; /// Made by the first interpret_parallel, one per thread. Deleted in the destructor.
+
+	/// A worker: the settings of the parent, and stacks, memo tables and a single thread of its own.
+	explicit Interpreter(Interpreter* parent);
+	/// Catches a worker up with the functions defined (or loaded) by its parent since the last time.
+	void follow();
+	/// The memo file of the parent for a worker, its own otherwise.
+	Memo_File& memo_file();
+
+	std::vector<void*> m_libraries; /// Handles of the loaded libraries. Closed in the destructor.
+	std::unordered_map<const User_Function*, const thisfunc_symbol*> m_library_functions; /// The precompiled native code of a function.
+
 	/// Like the copy of the Node, casts to every possible Node and calls the appropriate visit method.
 	bool visit(const Node* ast, std::ostream& out);
 	/// Puts the value in the stack. If the pointer is not a number token then outputs an error.
@@ -28,20 +115,234 @@ private:
 	bool visit_unary(const Unary_Operation_Node* node, std::ostream& out);
 	bool visit_binary(const Binary_Operation_Node* node, std::ostream& out);
 	bool visit_if(const If_Opeation_Node* node, std::ostream& out);
-	/// Visiting a list means printing its contents.
+	/// Visiting a list means packing its elements into a list value.
+	/// This and the ones below up to visit_zip (as well as the list builtins with two operands and axpy) find their operands
+	/// on the results, evaluated in the order operand() gives them.
 	bool visit_list(const List_Operation_Node* node, std::ostream& out);
-	/// Find the functions, pushes the element of the list to the vector and visits the definition of the map function.
-	std::vector<Node*> visit_map(const Map_Operation_Node* node, std::ostream& out);
-	/// Finds the function by name, transfers all the arguments from the stack to the vector and visits the definition.
+	/// Finds the function and calls it with every element of the list. Pushes the list of the results.
+	/// A sequence stays lazy: the function is only called once its elements are needed.
+	/// Nested maps and the parts of a concat are fused into one pass that writes every element once.
+	bool visit_map(const Map_Operation_Node* node, std::ostream& out);
+	/// sqrt, sin and cos of a list: pops it and pushes the list of the results, computed a chunk at a time by the vector kernels.
+	bool apply_builtin(const std::string& name, std::ostream& out);
+	/// pow where either operand is a list: element by element, with a number standing for every element. The operands are the top two results.
+	bool visit_pow(std::ostream& out);
+	/// reduce and foldl. The sums and products of builtins get computed as trees, over the threads for a long list.
+	bool visit_reduce(const Reduce_Operation_Node* node, std::ostream& out);
+	/// The checks are computed the way map does, then the elements that pass are packed into a new list.
+	bool visit_filter(const Filter_Operation_Node* node, std::ostream& out);
+	bool visit_zip(const Zip_Operation_Node* node, std::ostream& out);
+	/// The function that map and the like were given: a builtin by name (function is left nullptr) or a user function.
+	bool find_functor(const Node* functor, std::string& name, const User_Function*& function, std::ostream& out) const;
+	/// length, sum, min, max and mean of a list (the top result), as well as sort and argsort (the indices that would sort it).
+	/// A long list gets split over the threads.
+	bool visit_aggregate(const std::string& name, std::ostream& out);
+	/// The sum (add), the product (mul), the smallest (min) or the biggest (max) of the elements.
+	double total(const std::string& name, const Value& list);
+	/// The sum of the elements, the way m_summation says.
+	double sum(const Value& list);
+	/// dot(l1, l2) and norm(l) of vectors, axpy(a, x, y) = a * x + y and matvec(m, x), the product of a matrix with a vector.
+	/// A matrix is a flat list of its rows, one after the other. The operands are the top results.
+	bool visit_linear(const std::string& name, std::ostream& out);
+	/// The dot product, a block at a time (over the threads for long vectors) and then the sums of the blocks.
+	double dot(const double* x, const double* y, size_t count);
+	/// The chunks of the rope cut into blocks of at most BLOCK_SIZE elements. The floats of a single list get widened into buffer.
+	static std::vector<std::pair<const double*, size_t>> blocks_of(const Value& list, std::vector<double>& buffer);
+	/// Calls task(i) for each block. On the pool if they have enough elements between them.
+	void run_blocks(size_t blocks, size_t elements, const std::function<void(size_t)>& task);
+	/// Sorts in parallel if there are enough elements.
+	template<class I, class C>
+	void sort(I first, I last, C less)
+	{
+		if ((size_t)(last - first) >= m_parallel_threshold)
+		{
+			m_pool.sort(first, last, less);
+			return;
+		}
+
+		std::sort(first, last, less);
+	}
+	/// Calls the function for every row of the arguments, the way apply does for a single function.
+	bool call_each(const User_Function* function, const std::vector<const double*>& arguments, size_t count, double* results, std::ostream& out);
+	/// Gathers the lists that nested concats join, from left to right.
+	void collect_parts(const Node* node, std::vector<const Node*>& parts) const;
+	/// The index-th node whose value a list, map and the like, a list builtin with two operands or axpy works on.
+	/// nullptr once there are no more.
+	const Node* operand(const Node* node, size_t index) const;
+	/// Evaluates the operands of such a node, one after the other.
+	bool evaluate_operands(const Node* node, std::ostream& out);
+	/// Calls the visit method of such a node once its operands are the top results.
+	bool visit_evaluated(const Node* node, std::ostream& out);
+	/// concat(l1, l2) joins two lists. range(start, end) and from(start, step) make sequences (the latter endless).
+	/// take(count, l) keeps the first count elements of a list or a sequence and drop(count, l) the rest.
+	bool visit_list_function(const Binary_Operation_Node* node, std::ostream& out);
+	/// head(l) is the first element and tail(l) the rest. The list is the top result.
+	bool visit_list_function(const Unary_Operation_Node* node, std::ostream& out);
+	/// load(path) is a file of doubles as a list and csv(path, column) a column of a CSV file (see Data.h).
+	/// save(path, l) and savecsv(path, l) write the list out the same ways and give how many elements they wrote.
+	/// The path is not evaluated, so the node is either unary or binary.
+	bool visit_file_function(const Node* node, std::ostream& out);
+	/// How many elements a number asks for. Too many is as good as endless.
+	static size_t count_of(const double value);
+	/// Computes count elements of the sequence, from index on.
+	bool elements(const Sequence_Value& sequence, size_t index, size_t count, double* elements, std::ostream& out);
+	/// Calls the functions one after the other on every value, a column at a time where possible.
+	/// The blocks of a long list get spread over the pool. Whatever fails there is redone in order on the calling thread.
+	bool apply(const std::vector<const User_Function*>& functions, double* values, size_t count, std::ostream& out);
+	/// Evaluates the definition of a numeric function once for whole columns of arguments (arguments[i] is the column of #i).
+	/// Returns false if it cannot (lists, an error, too deep a recursion), in which case the results are left as they were.
+	/// The results may be one of the arguments.
+	/// This and the ones below only read the interpreter, so the threads of the pool can call them at the same time.
+	bool apply_column(const User_Function* function, const std::vector<const double*>& arguments, size_t count, double* results) const;
+	/// Calls the native code of the function for every row of arguments. Same as above if there is none or it bails out.
+	bool apply_native(const User_Function* function, const std::vector<const double*>& arguments, size_t count, double* results) const;
+	/// Evaluates the node for count rows at once. arguments[i] is the column of #i.
+	/// Every builtin goes over the whole column and if splits the rows between its branches.
+	/// The calls may nest depth levels deeper.
+	bool evaluate_column(const Node* node, const std::vector<const double*>& arguments, size_t count, double* result, size_t depth) const;
+	bool call_column(const std::string& name, const std::vector<const double*>& arguments, size_t count, double* result, size_t depth) const;
+	/// Applies sqrt, sin or cos to every element. The output may be the input.
+	void unary(const std::string& name, const double* input, double* output, size_t count) const;
+	void unary(const std::string& name, const float* input, float* output, size_t count) const;
+	/// Applies a binary builtin to every pair of elements, leaving the results in left. Returns false on a division by 0.
+	bool combine(const std::string& name, double* left, const double* right, size_t count) const;
+	/// Prints the elements a block at a time as they are computed, so that a long sequence never has to be stored.
+	bool print_sequence(const Sequence_Value& sequence, std::ostream& out);
+	/// Replaces the top count results (the operands of a builtin on numbers) with its result, computed in the numbers of the session.
+	bool arithmetic(const std::string& name, size_t count, std::ostream& out);
+	template<class T>
+	bool arithmetic(const std::string& name, size_t count, std::ostream& out);
+	/// Whether the value is the number 0, as if and nand see it.
+	bool is_zero(const Value& value) const;
+	/// 1 or 0, in the numbers of the session.
+	Value truth(bool value) const;
+	/// Rounds to single precision if that is what the numbers are. The rest stay as they are.
+	double narrow(double value) const;
+	void narrow(double* values, size_t count) const;
+	/// Takes over the elements and makes a new list out of them, of floats if those are the numbers.
+	Value list_of(std::vector<double>&& elements) const;
+	/// Pops the top result. Outputs an error if it is not a number.
+	bool pop_number(double& value, std::ostream& out);
+	/// Pops the top result. A sequence gets turned into a list.
+	/// Outputs an error if it is a number or an endless sequence.
+	bool pop_list(Value& list, std::ostream& out);
+	/// Pops as many lists as there is room for, keeping their order.
+	bool pop_lists(std::vector<Value>& lists, std::ostream& out);
+
+	/// Finds the function by name, evaluates all the arguments (or delays them in lazy mode) and calls it.
 	bool visit_user(const User_Function* node, std::ostream& out);
+	/// Adds a definition whose name has been checked, with a memo table if it should have one.
+	void add_function(const User_Function* node);
+	/// A new function may be what the functions that could not be compiled were missing.
+	void retry_unsupported();
+	/// Pushes the argument of a call as a thunk. Numbers and the arguments of the caller are passed on as they are.
+	bool delay(const Node* node, std::ostream& out);
+	/// Evaluates the thunk in the frame it was made in and keeps the value.
+	bool force(Thunk_Value* thunk, std::ostream& out);
+	/// Visits the node, or runs it on the explicit stack if that mode is on. Used wherever a value is needed.
+	bool evaluate(const Node* ast, std::ostream& out);
+	/// Advances the continuation on the top of the explicit stack by one stage.
+	bool step(std::ostream& out);
+	/// The stage of a node with operands: pushes the next operand, or visits the node once they are all evaluated.
+	bool step_operands(const Node* node, size_t stage, std::ostream& out);
+	/// Makes a call on the explicit stack. The arguments are the top count elements of the results.
+	bool call(const std::string& name, size_t count, std::ostream& out);
+	/// Finds a user function by name. Returns nullptr if there is none.
+	const User_Function* find_function(const std::string& name) const;
+	/// The only calling convention: the top count results become the frame of the function
+	/// and get replaced by its result once the definition is evaluated.
+	bool call_user(const std::string& name, size_t count, std::ostream& out);
+	bool call_user(const User_Function* function, size_t count, std::ostream& out);
+	/// Replaces the frame that starts at base with the result of the call.
+	void leave(size_t base, size_t count);
+	/// Same as below but with the frame on the results (which it replaces with the result).
+	bool call_native(const User_Function* function, size_t base, size_t count);
+	/// Calls the native version of the function (precompiled or from the JIT) if it has one.
+	/// Otherwise counts the call and queues the function for compilation once it gets hot.
+	/// Returns false if the interpreter has to make the call.
+	bool call_native(const User_Function* function, const double* arguments, size_t count, double& result);
+	/// Whether the function has native code (precompiled or from the JIT) ready.
+	bool is_native(const User_Function* function) const;
+	/// Queues the function for compilation once it has been called enough.
+	void count_calls(const User_Function* function, size_t calls);
+	/// Drops everything left over from an evaluation that failed.
+	void reset();
+	/// The table of the function if it is memoized and the frame at base holds only numbers, which get copied to arguments.
+	Memo* memo_of(const User_Function* function, size_t base, size_t count, double* arguments);
+	/// Replaces the frame with the result if the table has it.
+	bool recall(const User_Function* function, size_t base, size_t count);
+	/// Keeps the result on top of the frame in the table.
+	void remember(const User_Function* function, size_t base, size_t count);
+	/// A hash of the definition of the function and of every function it calls, i.e. of everything its results depend on.
+	/// Returns false while any of them is not defined, and for good if any of them reads or writes a file.
+	bool definition_hash(const User_Function* function, uint64_t& hash);
 
 public:
-	/// Sets the offset to 0.
+	static const size_t DEFAULT_TIER_THRESHOLD = 1000;
+	static const size_t DEFAULT_STACK_LIMIT = 1 << 22;
+	static const size_t MAX_NESTING = 1024; /// How many evaluations on the explicit stack may nest. Each takes some of the native stack.
+	static const size_t INITIAL_STACK_SIZE = 1 << 16; /// Preallocated so that the results seldom have to move.
+	static const size_t BLOCK_SIZE = 1024; /// How many elements map and the sequences compute at once.
+	static const size_t MAX_COLUMN_DEPTH = 256; /// How deep the calls may nest when evaluating a column. Deeper ones go one row at a time.
+	static const size_t DEFAULT_PARALLEL_THRESHOLD = 1 << 14;
+	static const size_t DEFAULT_MEMO_SIZE = 1 << 16;
+
+	/// Starts with no frame and turns the JIT on.
 	Interpreter();
 	Interpreter(const Interpreter& rhs) = delete;
 	Interpreter& operator=(const Interpreter& rhs) = delete;
 	~Interpreter();
 
 	/// Calls visit on the ast and then outputs a result, an error or does not output, in case of user function declaration/definition.
-	void interpret(const Node* ast, std::ostream& out);
+	/// Returns false if it output an error.
+	bool interpret(const Node* ast, std::ostream& out);
+
+	/// Interprets the expressions side by side over the threads, each on a worker that shares the functions
+	/// (and their native code) of this interpreter. What each of them prints is left in outputs, and whether it
+	/// succeeded in succeeded (chars, since the threads write next to each other). There must be no definitions among them.
+	/// Returns false if any of them failed.
+	bool interpret_parallel(const std::vector<const Node*>& expressions, std::vector<std::string>& outputs, std::vector<char>& succeeded);
+	/// Whether evaluating the expression may write a file, directly or through the functions it calls.
+	/// Those cannot run side by side with the expressions after them, which may read the file.
+	bool writes_files(const Node* ast) const;
+
+	/// Loads a library built by compile_library(): defines its functions and makes them call the native code.
+	bool load_library(const std::string& path, std::ostream& out);
+	/// Writes the user functions defined so far to an image (see Image.h).
+	bool save_image(const std::string& path, std::ostream& out) const;
+	/// Defines the functions of an image in the order they were defined, without lexing or parsing them.
+	/// Stops at the first one that cannot be defined (e.g. because the name is taken).
+	bool load_image(const std::string& path, std::ostream& out);
+
+	/// Production setups can turn the JIT off and only run the precompiled libraries natively.
+	void set_jit(bool enabled);
+	/// Sets how many calls it takes before a function gets compiled.
+	void set_tier_threshold(size_t calls);
+	/// Lazy mode evaluates an argument of a user function the first time the function uses it, and at most once.
+	/// Functions called with thunks run without their native code, which needs numbers.
+	void set_lazy(bool enabled);
+	/// With the explicit stack a deep recursion ends in a runtime error instead of a crash.
+	void set_explicit_stack(bool enabled);
+	/// How deep the explicit stack may get (in continuations and frames).
+	void set_stack_limit(size_t limit);
+	/// Fast accuracy trades the last few bits of sin, cos and pow over lists for speed. Numbers on their own are always exact.
+	void set_accuracy(Accuracy accuracy);
+	void set_summation(Summation summation);
+	/// Memoized functions are never compiled, since the native code would not look at the table.
+	/// Only calls with numbers for arguments are kept, and only the results that are numbers.
+	void set_memoization(Memoization memoization);
+	/// Set before the functions get defined.
+	void set_memo_size(size_t entries);
+	void set_eviction(Eviction eviction);
+	/// Shares the results of the memoized functions with other runs and processes through the file (see Memo_File).
+	/// Turns memoization on if it is off.
+	bool open_memo_file(const std::string& path, std::ostream& out);
+	/// The hits, misses and evictions of every memoized function, one per line (those of the workers included).
+	void print_memo_statistics(std::ostream& out) const;
+	/// Set before anything gets evaluated. Integers have no lists, and neither they nor floats run native code.
+	void set_numbers(Numbers numbers);
+	/// How many threads map may use, the calling one included. As many as the processor has by default.
+	void set_threads(size_t threads);
+	/// How long a list has to be before map spreads it over the threads.
+	void set_parallel_threshold(size_t elements);
 };
\ No newline at end of file
@@ -0,0 +1,865 @@
+#include "Jit.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <cstdint>
+#include <cstddef>
+
+#if defined(__x86_64__) && (defined(__linux__) || defined(__APPLE__))
+#include <pthread.h>
+#include <sys/mman.h>
+#define THISFUNC_JIT
+#endif
+
+static_assert(offsetof(Jit_Context, m_saved_stack) == 0, "The generated code expects the saved stack at offset 0");
+static_assert(offsetof(Jit_Context, m_failed) == 8, "The generated code expects the failure flag at offset 8");
+static_assert(offsetof(Jit_Context, m_stack_limit) == 16, "The generated code expects the stack limit at offset 16");
+
+namespace
+{
+	/// How much of the native stack the compiled code may use before it bails out.
+	const size_t STACK_BUDGET = 1 << 20;
+	/// How much it leaves above the real end of the stack, for the library functions it calls and for signal handlers.
+	const size_t STACK_GUARD = 64 << 10;
+
+	/// The lowest usable address of the calling thread's stack (above its guard pages), or 0 if it cannot be told.
+	uintptr_t find_stack_end()
+	{
+#if defined(THISFUNC_JIT) && defined(__linux__)
+		pthread_attr_t attributes;
+		void* address = nullptr;
+		size_t size = 0;
+		size_t guard = 0;
+
+		if (pthread_getattr_np(pthread_self(), &attributes) != 0)
+		{
+			return 0;
+		}
+
+		bool found = pthread_attr_getstack(&attributes, &address, &size) == 0;
+
+		pthread_attr_getguardsize(&attributes, &guard);
+		pthread_attr_destroy(&attributes);
+
+		return found ? (uintptr_t)address + guard : 0;
+#elif defined(THISFUNC_JIT) && defined(__APPLE__)
+		// macOS gives the top of the stack, which grows down from there.
+		return (uintptr_t)pthread_get_stackaddr_np(pthread_self()) - pthread_get_stacksize_np(pthread_self());
+#else
+		return 0;
+#endif
+	}
+
+	/// The stack of a thread does not move, so it is looked up once per thread.
+	uintptr_t stack_end()
+	{
+		thread_local uintptr_t end = find_stack_end();
+		return end;
+	}
+
+	/// The library functions are called through these so that their addresses are unambiguous.
+	double call_sin(double x)
+	{
+		return sin(x);
+	}
+
+	double call_cos(double x)
+	{
+		return cos(x);
+	}
+
+	double call_pow(double x, double y)
+	{
+		return pow(x, y);
+	}
+
+	const User_Function* find_function(const std::vector<const Node*>& user_functions, const std::string& name)
+	{
+		for (const Node* a : user_functions)
+		{
+			const User_Function* current_ptr = dynamic_cast<const User_Function*>(a);
+
+			if (current_ptr && dynamic_cast<const Function_Token*>(current_ptr->m_token)->m_name == name)
+			{
+				return current_ptr;
+			}
+		}
+
+		return nullptr;
+	}
+
+	/// Writes the machine code into a growing buffer. Jumps and calls go to labels which are patched in finish().
+	class Assembler
+	{
+	private:
+		struct Fixup
+		{
+			size_t m_at; /// Where the 32-bit displacement is.
+			size_t m_label;
+		};
+
+		std::vector<unsigned char> m_bytes;
+		std::vector<size_t> m_labels; /// The position of every label. SIZE_MAX until bound.
+		std::vector<Fixup> m_fixups;
+
+	public:
+		size_t position() const
+		{
+			return m_bytes.size();
+		}
+
+		const std::vector<unsigned char>& bytes() const
+		{
+			return m_bytes;
+		}
+
+		void emit(std::initializer_list<unsigned char> bytes)
+		{
+			m_bytes.insert(m_bytes.end(), bytes);
+		}
+
+		void imm32(int32_t value)
+		{
+			for (int i = 0; i < 4; ++i)
+			{
+				m_bytes.push_back((value >> (8 * i)) & 0xFF);
+			}
+		}
+
+		void imm64(uint64_t value)
+		{
+			for (int i = 0; i < 8; ++i)
+			{
+				m_bytes.push_back((value >> (8 * i)) & 0xFF);
+			}
+		}
+
+		void patch32(size_t at, int32_t value)
+		{
+			for (int i = 0; i < 4; ++i)
+			{
+				m_bytes[at + i] = (value >> (8 * i)) & 0xFF;
+			}
+		}
+
+		size_t new_label()
+		{
+			m_labels.push_back(SIZE_MAX);
+			return m_labels.size() - 1;
+		}
+
+		void bind(size_t label)
+		{
+			m_labels[label] = m_bytes.size();
+		}
+
+		/// Emits a placeholder for the distance to the label.
+		void rel32(size_t label)
+		{
+			m_fixups.push_back({ m_bytes.size(), label });
+			imm32(0);
+		}
+
+		/// Resolves the labels. Returns false if one of them was never bound.
+		bool finish()
+		{
+			for (const Fixup& a : m_fixups)
+			{
+				if (m_labels[a.m_label] == SIZE_MAX)
+				{
+					return false;
+				}
+
+				patch32(a.m_at, (int32_t)(m_labels[a.m_label] - (a.m_at + 4)));
+			}
+
+			return true;
+		}
+
+		// Instructions. Only xmm0-xmm7 are used so no REX prefix is needed for them.
+
+		/// movsd xmm, [rbp - 8 * (slot + 1)]
+		void load_slot(int xmm, size_t slot)
+		{
+			emit({ 0xF2, 0x0F, 0x10, (unsigned char)(0x85 | xmm << 3) });
+			imm32(-8 * (int32_t)(slot + 1));
+		}
+
+		/// movsd [rbp - 8 * (slot + 1)], xmm
+		void store_slot(size_t slot, int xmm)
+		{
+			emit({ 0xF2, 0x0F, 0x11, (unsigned char)(0x85 | xmm << 3) });
+			imm32(-8 * (int32_t)(slot + 1));
+		}
+
+		/// mov rax, bits; movq xmm, rax
+		void load_constant(int xmm, double value)
+		{
+			uint64_t bits;
+			memcpy(&bits, &value, sizeof(bits));
+
+			emit({ 0x48, 0xB8 });
+			imm64(bits);
+			emit({ 0x66, 0x48, 0x0F, 0x6E, (unsigned char)(0xC0 | xmm << 3) });
+		}
+
+		/// An SSE instruction working on two registers: prefix 0F opcode modrm.
+		void sse(unsigned char prefix, unsigned char opcode, int dst, int src)
+		{
+			emit({ prefix, 0x0F, opcode, (unsigned char)(0xC0 | dst << 3 | src) });
+		}
+
+		/// cmpsd dst, src, predicate (0 is ==, 1 is <)
+		void compare(int dst, int src, unsigned char predicate)
+		{
+			emit({ 0xF2, 0x0F, 0xC2, (unsigned char)(0xC0 | dst << 3 | src), predicate });
+		}
+
+		/// The conditional near jumps: 0x82 jb, 0x84 je, 0x8A jp.
+		void jump_if(unsigned char condition, size_t label)
+		{
+			emit({ 0x0F, condition });
+			rel32(label);
+		}
+
+		void jump(size_t label)
+		{
+			emit({ 0xE9 });
+			rel32(label);
+		}
+
+		void call(size_t label)
+		{
+			emit({ 0xE8 });
+			rel32(label);
+		}
+
+		/// mov rax, address; call rax
+		void call_absolute(const void* address)
+		{
+			emit({ 0x48, 0xB8 });
+			imm64((uint64_t)(uintptr_t)address);
+			emit({ 0xFF, 0xD0 });
+		}
+	};
+
+	/// Walks a function and everything it calls, checking that only the supported nodes are used.
+	class Collector
+	{
+	private:
+		const std::vector<const Node*>& m_user_functions;
+
+		std::vector<const User_Function*>& m_functions;
+
+		/// Adds the function unless it is there already. It has to be called with as many arguments as its definition uses.
+		bool collect(const User_Function* function, size_t arity)
+		{
+			for (const User_Function* a : m_functions)
+			{
+				if (a == function)
+				{
+					return Jit::arity(function->m_definition) == arity;
+				}
+			}
+
+			// Native code would call a memoized function without looking at its table.
+			if (!function->m_definition || Jit::arity(function->m_definition) != arity || function->m_tier == Tier::MEMOIZED)
+			{
+				return false;
+			}
+
+			m_functions.push_back(function);
+
+			return check(function->m_definition);
+		}
+
+		/// Checks whether the node is supported and collects the functions that it calls.
+		bool check_call(const std::string& name, size_t arity)
+		{
+			const User_Function* callee = find_function(m_user_functions, name);
+			return callee && collect(callee, arity);
+		}
+
+		bool check(const Node* node)
+		{
+			if (!node)
+			{
+				return false;
+			}
+
+			const Factor_Node* f_ptr = dynamic_cast<const Factor_Node*>(node);
+
+			if (f_ptr)
+			{
+				return dynamic_cast<const Number_Token*>(f_ptr->m_token) != nullptr;
+			}
+
+			if (dynamic_cast<const Argument_Node*>(node))
+			{
+				return true;
+			}
+
+			const Unary_Operation_Node* u_ptr = dynamic_cast<const Unary_Operation_Node*>(node);
+
+			if (u_ptr)
+			{
+				const std::string& name = dynamic_cast<const Function_Token*>(u_ptr->m_token)->m_name;
+				return !is_list_builtin(name) && check(u_ptr->m_argument) && (is_unary_builtin(name) || check_call(name, 1));
+			}
+
+			const Binary_Operation_Node* b_ptr = dynamic_cast<const Binary_Operation_Node*>(node);
+
+			if (b_ptr)
+			{
+				const std::string& name = dynamic_cast<const Function_Token*>(b_ptr->m_token)->m_name;
+
+				if (is_list_builtin(name))
+				{
+					return false;
+				}
+
+				return check(b_ptr->m_left) && check(b_ptr->m_right) && (is_binary_builtin(name) || check_call(name, 2));
+			}
+
+			const If_Opeation_Node* i_ptr = dynamic_cast<const If_Opeation_Node*>(node);
+
+			if (i_ptr)
+			{
+				return check(i_ptr->m_check) && check(i_ptr->m_left) && check(i_ptr->m_right);
+			}
+
+			const User_Function* u_f_ptr = dynamic_cast<const User_Function*>(node);
+
+			if (u_f_ptr && !u_f_ptr->m_definition)
+			{
+				for (const Node* a : u_f_ptr->m_arguments)
+				{
+					if (!check(a))
+					{
+						return false;
+					}
+				}
+
+				return check_call(dynamic_cast<const Function_Token*>(u_f_ptr->m_token)->m_name, u_f_ptr->m_arguments.size());
+			}
+
+			return false;
+		}
+
+	public:
+		Collector(const std::vector<const Node*>& user_functions, std::vector<const User_Function*>& functions)
+			: m_user_functions(user_functions),
+			m_functions(functions)
+		{ }
+
+		bool collect(const User_Function* function)
+		{
+			return collect(function, Jit::arity(function->m_definition));
+		}
+	};
+
+	/// Compiles a function together with everything it calls into one piece of code.
+	/// The code keeps rbx pointing to the Jit_Context for the whole call.
+	/// Every function gets a frame with its arguments followed by the temporaries of the expression.
+	class Compiler
+	{
+	private:
+		struct Function_Info
+		{
+			const User_Function* m_function;
+			size_t m_arity;
+			size_t m_label;
+		};
+
+		const std::vector<const Node*>& m_user_functions;
+
+		Assembler m_asm;
+
+		std::vector<Function_Info> m_functions; /// The first one is the function that was asked for.
+
+		size_t m_error; /// Label of the code that bails out on a division by 0.
+		size_t m_overflow; /// Label of the code that bails out when the stack runs out.
+
+		size_t m_arity; /// Of the function that is currently being emitted.
+		size_t m_max_depth; /// How many temporaries it needs.
+
+		size_t index_of(const User_Function* function) const
+		{
+			for (size_t i = 0; i < m_functions.size(); ++i)
+			{
+				if (m_functions[i].m_function == function)
+				{
+					return i;
+				}
+			}
+
+			return SIZE_MAX;
+		}
+
+		/// Stores the result of the temporary in its slot, right after the arguments.
+		void store_temporary(size_t depth)
+		{
+			if (depth + 1 > m_max_depth)
+			{
+				m_max_depth = depth + 1;
+			}
+
+			m_asm.store_slot(m_arity + depth, 0);
+		}
+
+		/// Evaluates the arguments into temporaries, moves them to xmm0-xmmN and calls the function.
+		void emit_call(const std::string& name, const std::vector<const Node*>& arguments, size_t depth)
+		{
+			for (size_t i = 0; i < arguments.size(); ++i)
+			{
+				emit(arguments[i], depth + i);
+				store_temporary(depth + i);
+			}
+
+			for (size_t i = 0; i < arguments.size(); ++i)
+			{
+				m_asm.load_slot((int)i, m_arity + depth + i);
+			}
+
+			m_asm.call(m_functions[index_of(find_function(m_user_functions, name))].m_label);
+		}
+
+		/// Leaves the value of the node in xmm0. Temporaries from depth onward are free to use.
+		void emit(const Node* node, size_t depth)
+		{
+			const Factor_Node* f_ptr = dynamic_cast<const Factor_Node*>(node);
+
+			if (f_ptr)
+			{
+				m_asm.load_constant(0, dynamic_cast<const Number_Token*>(f_ptr->m_token)->m_value);
+				return;
+			}
+
+			const Argument_Node* a_ptr = dynamic_cast<const Argument_Node*>(node);
+
+			if (a_ptr)
+			{
+				m_asm.load_slot(0, dynamic_cast<const Argument_Token*>(a_ptr->m_token)->m_value);
+				return;
+			}
+
+			const Unary_Operation_Node* u_ptr = dynamic_cast<const Unary_Operation_Node*>(node);
+
+			if (u_ptr)
+			{
+				const std::string& name = dynamic_cast<const Function_Token*>(u_ptr->m_token)->m_name;
+
+				if (!is_unary_builtin(name))
+				{
+					emit_call(name, { u_ptr->m_argument }, depth);
+					return;
+				}
+
+				emit(u_ptr->m_argument, depth);
+
+				if (name == "sqrt")
+				{
+					m_asm.sse(0xF2, 0x51, 0, 0); // sqrtsd xmm0, xmm0
+				}
+				else
+				{
+					m_asm.call_absolute((const void*)(name == "sin" ? &call_sin : &call_cos));
+				}
+				return;
+			}
+
+			const Binary_Operation_Node* b_ptr = dynamic_cast<const Binary_Operation_Node*>(node);
+
+			if (b_ptr)
+			{
+				const std::string& name = dynamic_cast<const Function_Token*>(b_ptr->m_token)->m_name;
+
+				if (!is_binary_builtin(name))
+				{
+					emit_call(name, { b_ptr->m_left, b_ptr->m_right }, depth);
+					return;
+				}
+
+				// The left side waits in a temporary while the right one is being computed.
+				emit(b_ptr->m_left, depth);
+				store_temporary(depth);
+				emit(b_ptr->m_right, depth + 1);
+				m_asm.sse(0x66, 0x28, 1, 0); // movapd xmm1, xmm0
+				m_asm.load_slot(0, m_arity + depth);
+
+				if (name == "add")
+				{
+					m_asm.sse(0xF2, 0x58, 0, 1);
+				}
+				else if (name == "sub")
+				{
+					m_asm.sse(0xF2, 0x5C, 0, 1);
+				}
+				else if (name == "mul")
+				{
+					m_asm.sse(0xF2, 0x59, 0, 1);
+				}
+				else if (name == "div")
+				{
+					size_t ok = m_asm.new_label();
+					m_asm.sse(0x66, 0x57, 2, 2); // xorpd xmm2, xmm2
+					m_asm.sse(0x66, 0x2E, 1, 2); // ucomisd xmm1, xmm2
+					m_asm.jump_if(0x8A, ok); // NaN is not 0.
+					m_asm.jump_if(0x84, m_error);
+					m_asm.bind(ok);
+					m_asm.sse(0xF2, 0x5E, 0, 1);
+				}
+				else if (name == "pow")
+				{
+					m_asm.call_absolute((const void*)&call_pow);
+				}
+				else
+				{
+					// The comparisons give a mask of ones which is turned into 1.0 (or 0.0) by and-ing it with 1.0.
+					if (name == "eq")
+					{
+						m_asm.compare(0, 1, 0);
+					}
+					else if (name == "le")
+					{
+						m_asm.compare(0, 1, 1);
+					}
+					else // nand is 1 when either side is 0.
+					{
+						m_asm.sse(0x66, 0x57, 2, 2);
+						m_asm.compare(0, 2, 0);
+						m_asm.compare(1, 2, 0);
+						m_asm.sse(0x66, 0x56, 0, 1); // orpd xmm0, xmm1
+					}
+
+					m_asm.load_constant(1, 1.0);
+					m_asm.sse(0x66, 0x54, 0, 1); // andpd xmm0, xmm1
+				}
+				return;
+			}
+
+			const If_Opeation_Node* i_ptr = dynamic_cast<const If_Opeation_Node*>(node);
+
+			if (i_ptr)
+			{
+				size_t left = m_asm.new_label();
+				size_t right = m_asm.new_label();
+				size_t end = m_asm.new_label();
+
+				emit(i_ptr->m_check, depth);
+				m_asm.sse(0x66, 0x57, 1, 1); // xorpd xmm1, xmm1
+				m_asm.sse(0x66, 0x2E, 0, 1); // ucomisd xmm0, xmm1
+				m_asm.jump_if(0x8A, left);
+				m_asm.jump_if(0x84, right);
+				m_asm.bind(left);
+				emit(i_ptr->m_left, depth);
+				m_asm.jump(end);
+				m_asm.bind(right);
+				emit(i_ptr->m_right, depth);
+				m_asm.bind(end);
+				return;
+			}
+
+			const User_Function* u_f_ptr = dynamic_cast<const User_Function*>(node);
+
+			emit_call(dynamic_cast<const Function_Token*>(u_f_ptr->m_token)->m_name, u_f_ptr->m_arguments, depth);
+		}
+
+		void emit_function(const Function_Info& info)
+		{
+			m_arity = info.m_arity;
+			m_max_depth = 0;
+
+			m_asm.bind(info.m_label);
+			m_asm.emit({ 0x55 }); // push rbp
+			m_asm.emit({ 0x48, 0x89, 0xE5 }); // mov rbp, rsp
+			m_asm.emit({ 0x48, 0x81, 0xEC }); // sub rsp, frame size
+			size_t frame_size = m_asm.position();
+			m_asm.imm32(0);
+			m_asm.emit({ 0x48, 0x3B, 0x63, 0x10 }); // cmp rsp, [rbx + 16]
+			m_asm.jump_if(0x82, m_overflow);
+
+			for (size_t i = 0; i < m_arity; ++i)
+			{
+				m_asm.store_slot(i, (int)i);
+			}
+
+			emit(info.m_function->m_definition, 0);
+
+			m_asm.emit({ 0x48, 0x89, 0xEC }); // mov rsp, rbp
+			m_asm.emit({ 0x5D, 0xC3 }); // pop rbp; ret
+
+			// Keep the stack aligned to 16 bytes for the calls.
+			m_asm.patch32(frame_size, (int32_t)((8 * (m_arity + m_max_depth) + 15) & ~(size_t)15));
+		}
+
+	public:
+		explicit Compiler(const std::vector<const Node*>& user_functions)
+			: m_user_functions(user_functions),
+			m_error(0),
+			m_overflow(0),
+			m_arity(0),
+			m_max_depth(0)
+		{ }
+
+		/// Returns false if the function cannot be compiled. The entry is at the beginning of the code.
+		bool compile(const User_Function* function)
+		{
+			m_error = m_asm.new_label();
+			m_overflow = m_asm.new_label();
+
+			std::vector<const User_Function*> functions;
+
+			if (!Jit::collect(function, m_user_functions, functions))
+			{
+				return false;
+			}
+
+			for (const User_Function* a : functions)
+			{
+				size_t arity = Jit::arity(a->m_definition);
+
+				if (arity > Jit::MAX_ARITY)
+				{
+					return false;
+				}
+
+				m_functions.push_back({ a, arity, m_asm.new_label() });
+			}
+
+			size_t arity = m_functions[0].m_arity;
+
+			// The entry: saves the context in rbx and the stack pointer in the context, then calls the function.
+			m_asm.emit({ 0x55 }); // push rbp
+			m_asm.emit({ 0x48, 0x89, 0xE5 }); // mov rbp, rsp
+			m_asm.emit({ 0x53 }); // push rbx
+			m_asm.emit({ 0x48, 0x83, 0xEC, 0x08 }); // sub rsp, 8
+			m_asm.emit({ 0x48, 0x89, 0xF3 }); // mov rbx, rsi
+			m_asm.emit({ 0x48, 0x89, 0x23 }); // mov [rbx], rsp
+
+			for (size_t i = 0; i < arity; ++i)
+			{
+				m_asm.emit({ 0xF2, 0x0F, 0x10, (unsigned char)(0x47 | i << 3), (unsigned char)(8 * i) }); // movsd xmmi, [rdi + 8 * i]
+			}
+
+			m_asm.call(m_functions[0].m_label);
+			m_asm.emit({ 0x48, 0x83, 0xC4, 0x08 }); // add rsp, 8
+			m_asm.emit({ 0x5B, 0x5D, 0xC3 }); // pop rbx; pop rbp; ret
+
+			// Bailing out: mark why and return straight from the entry.
+			size_t bail_out = m_asm.new_label();
+			m_asm.bind(m_error);
+			m_asm.emit({ 0xC6, 0x43, 0x08, (unsigned char)Jit_Failure::DIVISION_BY_ZERO }); // mov byte [rbx + 8], DIVISION_BY_ZERO
+			m_asm.jump(bail_out);
+			m_asm.bind(m_overflow);
+			m_asm.emit({ 0xC6, 0x43, 0x08, (unsigned char)Jit_Failure::STACK }); // mov byte [rbx + 8], STACK
+			m_asm.bind(bail_out);
+			m_asm.emit({ 0x48, 0x8B, 0x23 }); // mov rsp, [rbx]
+			m_asm.emit({ 0x48, 0x83, 0xC4, 0x08 }); // add rsp, 8
+			m_asm.emit({ 0x5B, 0x5D, 0xC3 }); // pop rbx; pop rbp; ret
+
+			for (const Function_Info& a : m_functions)
+			{
+				emit_function(a);
+			}
+
+			return m_asm.finish();
+		}
+
+		const std::vector<unsigned char>& code() const
+		{
+			return m_asm.bytes();
+		}
+	};
+}
+
+Jit::Jit()
+	: m_stopping(false)
+{ }
+
+Jit::~Jit()
+{
+	stop();
+
+#ifdef THISFUNC_JIT
+	for (const Code& a : m_code)
+	{
+		munmap(a.m_memory, a.m_size);
+	}
+#endif
+}
+
+void Jit::request(const User_Function* function, const std::vector<const Node*>& user_functions)
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+
+	if (m_stopping)
+	{
+		return;
+	}
+
+	m_requests.push_back({ function, user_functions });
+
+	if (!m_worker.joinable())
+	{
+		m_worker = std::thread(&Jit::work, this);
+	}
+
+	m_wake.notify_one();
+}
+
+void Jit::stop()
+{
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_stopping = true;
+		m_requests.clear();
+	}
+
+	m_wake.notify_one();
+
+	if (m_worker.joinable())
+	{
+		m_worker.join();
+	}
+}
+
+void Jit::work()
+{
+	std::unique_lock<std::mutex> lock(m_mutex);
+
+	while (true)
+	{
+		m_wake.wait(lock, [this] { return m_stopping || !m_requests.empty(); });
+
+		if (m_stopping)
+		{
+			return;
+		}
+
+		Request request = m_requests.front();
+		m_requests.pop_front();
+
+		lock.unlock();
+		compile(request);
+		lock.lock();
+	}
+}
+
+void Jit::compile(const Request& request)
+{
+	const User_Function* function = request.m_function;
+
+#ifdef THISFUNC_JIT
+	Compiler c(request.m_user_functions);
+
+	if (c.compile(function))
+	{
+		const std::vector<unsigned char>& code = c.code();
+
+		void* memory = mmap(nullptr, code.size(), PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+		if (memory != MAP_FAILED)
+		{
+			memcpy(memory, code.data(), code.size());
+
+			if (mprotect(memory, code.size(), PROT_READ | PROT_EXEC) == 0)
+			{
+				std::lock_guard<std::mutex> lock(m_mutex);
+
+				m_code.push_back({ memory, code.size() });
+				m_functions.push_back({ (Jit_Entry)memory, Jit::arity(function->m_definition) });
+
+				function->m_native.store(&m_functions.back(), std::memory_order_release);
+				function->m_tier.store(Tier::COMPILED, std::memory_order_release);
+				return;
+			}
+
+			munmap(memory, code.size());
+		}
+	}
+#endif
+
+	function->m_tier.store(Tier::UNSUPPORTED, std::memory_order_release);
+}
+
+Jit_Failure Jit::call(const Jit_Function* function, const double* arguments, double& result)
+{
+	char marker; // Roughly where the stack is now.
+
+	Jit_Context context;
+	context.m_saved_stack = nullptr;
+	context.m_failed = Jit_Failure::NONE;
+
+	// The budget counts from wherever the interpreter got to, which may already be close to the end of the stack
+	// (in a deep recursion), so the end bounds it as well. A limit above the marker makes the code bail out at once.
+	uintptr_t limit = (uintptr_t)&marker - STACK_BUDGET;
+	uintptr_t end = stack_end();
+
+	if (end && end + STACK_GUARD > limit)
+	{
+		limit = end + STACK_GUARD;
+	}
+
+	context.m_stack_limit = (void*)limit;
+
+	result = function->m_entry(arguments, &context);
+
+	return context.m_failed;
+}
+
+bool Jit::collect(const User_Function* function, const std::vector<const Node*>& user_functions, std::vector<const User_Function*>& functions)
+{
+	return Collector(user_functions, functions).collect(function);
+}
+
+size_t Jit::arity(const Node* definition)
+{
+	if (!definition)
+	{
+		return 0;
+	}
+
+	const Argument_Node* a_ptr = dynamic_cast<const Argument_Node*>(definition);
+
+	if (a_ptr)
+	{
+		return dynamic_cast<const Argument_Token*>(a_ptr->m_token)->m_value + 1;
+	}
+
+	size_t result = 0;
+
+	const Unary_Operation_Node* u_ptr = dynamic_cast<const Unary_Operation_Node*>(definition);
+
+	if (u_ptr)
+	{
+		return arity(u_ptr->m_argument);
+	}
+
+	const Binary_Operation_Node* b_ptr = dynamic_cast<const Binary_Operation_Node*>(definition);
+
+	if (b_ptr)
+	{
+		return std::max(arity(b_ptr->m_left), arity(b_ptr->m_right));
+	}
+
+	const If_Opeation_Node* i_ptr = dynamic_cast<const If_Opeation_Node*>(definition);
+
+	if (i_ptr)
+	{
+		return std::max(arity(i_ptr->m_check), std::max(arity(i_ptr->m_left), arity(i_ptr->m_right)));
+	}
+
+	const User_Function* u_f_ptr = dynamic_cast<const User_Function*>(definition);
+
+	if (u_f_ptr)
+	{
+		for (const Node* a : u_f_ptr->m_arguments)
+		{
+			result = std::max(result, arity(a));
+		}
+	}
+
+	return result;
+}
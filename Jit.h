@@ -0,0 +1,101 @@
+#pragma once
+
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include "Parser.h"
+
+//#################################################
+// JIT
+//#################################################
+
+/// Why the native code bailed out.
+enum class Jit_Failure : unsigned char
+{
+	NONE,
+	DIVISION_BY_ZERO,
+	STACK /// It went deeper than the native stack it may use.
+};
+
+/// State shared between a call from the interpreter and the generated code.
+/// The generated code addresses the fields by offset, so the layout must not change.
+struct Jit_Context
+{
+	void* m_saved_stack; /// The stack pointer at the entry. Restored when the native code has to bail out.
+	Jit_Failure m_failed; /// Set by the native code when it bails out.
+	void* m_stack_limit; /// The native code does not go below this address.
+};
+
+/// Takes the arguments packed in an array. The result is returned as usual.
+typedef double (*Jit_Entry)(const double* arguments, Jit_Context* context);
+
+/// A compiled function as it is published to the interpreter.
+struct Jit_Function
+{
+	Jit_Entry m_entry;
+	size_t m_arity;
+};
+
+/// Compiles numeric user functions to x86-64 machine code.
+/// Supported are numbers, arguments, add, sub, mul, div, pow, sqrt, sin, cos, eq, le, nand, if and calls to other such functions.
+/// The arguments live in the XMM registers and calls between compiled functions are direct native calls.
+/// Everything else (lists, map, concat, ...) is left to the interpreter.
+/// The compilation happens on a background thread so the caller never waits for it.
+class Jit
+{
+private:
+	struct Code
+	{
+		void* m_memory;
+		size_t m_size;
+	};
+
+	struct Request
+	{
+		const User_Function* m_function;
+		std::vector<const Node*> m_user_functions; /// A copy, since more functions may get defined while it is being compiled.
+	};
+
+	std::vector<Code> m_code; /// The executable pages of every compiled function. Unmapped in the destructor.
+	std::deque<Jit_Function> m_functions; /// A deque so that the published pointers stay valid.
+
+	std::deque<Request> m_requests;
+	std::thread m_worker; /// Started by the first request.
+	std::mutex m_mutex; /// Guards everything above.
+	std::condition_variable m_wake;
+	bool m_stopping;
+
+	/// The loop of the background thread.
+	void work();
+	/// Compiles the function and publishes the result in it.
+	void compile(const Request& request);
+
+public:
+	/// The most arguments a compiled function can take (they all have to fit in xmm0-xmm7).
+	static const size_t MAX_ARITY = 8;
+
+	Jit();
+	Jit(const Jit& rhs) = delete;
+	Jit& operator=(const Jit& rhs) = delete;
+	/// Stops the background thread if it is still running.
+	~Jit();
+
+	/// Queues the function for compilation. The function has to be marked as Tier::QUEUED already.
+	/// When done, it becomes Tier::COMPILED with m_native set, or Tier::UNSUPPORTED.
+	void request(const User_Function* function, const std::vector<const Node*>& user_functions);
+
+	/// Drops the queued requests and waits for the one in progress. Has to be called before the functions get deleted.
+	void stop();
+
+	/// Calls the native code. Returns why it bailed out (Jit_Failure::NONE if it did not), in which case the interpreter
+	/// has to redo the call so that the proper error gets reported.
+	static Jit_Failure call(const Jit_Function* function, const double* arguments, double& result);
+
+	/// Collects the function and everything it calls, in the order they are reached.
+	/// Returns false if any of them uses something that cannot be compiled or is called with the wrong number of arguments.
+	static bool collect(const User_Function* function, const std::vector<const Node*>& user_functions, std::vector<const User_Function*>& functions);
+
+	/// The number of arguments the definition uses, i.e. the biggest #n plus one.
+	static size_t arity(const Node* definition);
+};
@@ -0,0 +1,1228 @@
+#include "Kernels.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cfloat>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#include <immintrin.h>
+#define THISFUNC_SIMD
+#define THISFUNC_AVX2 __attribute__((target("avx2,fma")))
+#define THISFUNC_AVX512 __attribute__((target("avx512f")))
+#endif
+
+namespace
+{
+	// sin and cos reduce x to r = x - k * pi/2 with |r| <= pi/4, where pi/2 is split into parts of 33 bits
+	// so that k * PIO2_1 and k * PIO2_2 are exact as long as k < 2^20.
+	const double TWO_OVER_PI = 6.36619772367581382433e-01;
+	const double PIO2_1 = 1.57079632673412561417e+00;
+	const double PIO2_2 = 6.07710050630396597660e-11;
+	const double PIO2_3 = 2.02226624871116645580e-21;
+	const double REDUCTION_LIMIT = 1048576.0;
+
+	// Adding it rounds a number below 2^51 to an integer, which ends up in the low bits of the sum.
+	const double ROUNDING = 6755399441055744.0;
+	const uint64_t ROUNDING_BITS = 0x4338000000000000;
+
+	// The minimax polynomials of sin and cos on [-pi/4, pi/4] (from Cephes).
+	const double S1 = -1.66666666666666307295e-01;
+	const double S2 = 8.33333333332211858878e-03;
+	const double S3 = -1.98412698295895385996e-04;
+	const double S4 = 2.75573136213857245213e-06;
+	const double S5 = -2.50507477628578072866e-08;
+	const double S6 = 1.58962301576546568060e-10;
+
+	const double C1 = 4.16666666666665929218e-02;
+	const double C2 = -1.38888888888730564116e-03;
+	const double C3 = 2.48015872888517045348e-05;
+	const double C4 = -2.75573141792967388112e-07;
+	const double C5 = 2.08757008419747316778e-09;
+	const double C6 = -1.13585365213876817300e-11;
+
+	// pow(x, y) = exp(y * log(x)). ln(2) is split so that n * LN2_HI is exact for the exponents of a double.
+	const double LN2_HI = 6.93147180369123816490e-01;
+	const double LN2_LO = 1.90821492927058770002e-10;
+	const double LOG2_E = 1.44269504088896338700e+00;
+	const double SQRT_2 = 1.41421356237309514547e+00;
+	const double EXP_LIMIT = 708.0; /// exp of anything larger would not be a normal number.
+	const double SPLIT = 134217729.0; /// 2^27 + 1, which splits a double into two halves of 26 bits (Dekker).
+	const double SPLIT_LIMIT = 1e300; /// Larger numbers would overflow when split.
+
+	// The polynomials below are split into their even and odd terms, which get computed side by side (the chains are half as long).
+
+	/// The series of atanh, which gives log(m): 1/3 + f^2/5 + f^4/7 + ... + f^20/23, in powers of f^4 from the highest down.
+	const double LOG_EVEN[] = { 1.0 / 23, 1.0 / 19, 1.0 / 15, 1.0 / 11, 1.0 / 7, 1.0 / 3 };
+	const double LOG_ODD[] = { 1.0 / 21, 1.0 / 17, 1.0 / 13, 1.0 / 9, 1.0 / 5 };
+	/// The Taylor series of exp up to r^13 / 13!, which is already below the rounding error, in powers of r^2.
+	const double EXP_EVEN[] = { 1.0 / 479001600, 1.0 / 3628800, 1.0 / 40320, 1.0 / 720, 1.0 / 24, 1.0 / 2, 1.0 };
+	const double EXP_ODD[] = { 1.0 / 6227020800, 1.0 / 39916800, 1.0 / 362880, 1.0 / 5040, 1.0 / 120, 1.0 / 6, 1.0 };
+
+	// The same for floats, with pi/2 in parts of 8, 11, 11 and 24 bits. The products of the first three with k are exact
+	// as long as k < 2^13, which is the case for |x| < 8192.
+	const float TWO_OVER_PI_FLOAT = 6.36619772e-01f;
+	const float PIO2_1_FLOAT = 1.5703125f;
+	const float PIO2_2_FLOAT = 4.837512969970703125e-4f;
+	const float PIO2_3_FLOAT = 7.5495336204767227172851562e-8f;
+	const float PIO2_4_FLOAT = 2.5633440682570896029801588e-12f;
+	const float REDUCTION_LIMIT_FLOAT = 8192.0f;
+	const float ROUNDING_FLOAT = 12582912.0f; /// 1.5 * 2^23, the same trick for floats (below 2^22).
+
+	// The minimax polynomials of sinf and cosf on [-pi/4, pi/4] (from Cephes).
+	const float S1_FLOAT = -1.6666654611e-1f;
+	const float S2_FLOAT = 8.3321608736e-3f;
+	const float S3_FLOAT = -1.9515295891e-4f;
+
+	const float C1_FLOAT = 4.166664568298827e-2f;
+	const float C2_FLOAT = -1.388731625493765e-3f;
+	const float C3_FLOAT = 2.443315711809948e-5f;
+
+	const uint64_t MANTISSA_BITS = 0x000FFFFFFFFFFFFF;
+	const uint64_t ONE_BITS = 0x3FF0000000000000;
+	const uint64_t SIGN_BITS = 0x8000000000000000;
+	const uint64_t EXPONENT_OFFSET_BITS = 0x4330000000000000; /// 2^52, so that a small integer in the low bits reads as 2^52 + it.
+
+	uint64_t bits_of(double value)
+	{
+		uint64_t bits;
+		memcpy(&bits, &value, sizeof(bits));
+		return bits;
+	}
+
+	double from_bits(uint64_t bits)
+	{
+		double value;
+		memcpy(&value, &bits, sizeof(value));
+		return value;
+	}
+
+	uint32_t bits_of(float value)
+	{
+		uint32_t bits;
+		memcpy(&bits, &value, sizeof(bits));
+		return bits;
+	}
+
+	float from_bits(uint32_t bits)
+	{
+		float value;
+		memcpy(&value, &bits, sizeof(value));
+		return value;
+	}
+
+	/// The operations the kernels need, one element at a time. Used for what is left after the last full vector.
+	struct Scalar
+	{
+		typedef double Element;
+		typedef double Vector;
+		typedef bool Mask;
+
+		static const size_t WIDTH = 1;
+
+		static Vector load(const double* p) { return *p; }
+		static void store(double* p, Vector v) { *p = v; }
+		static Vector set(double v) { return v; }
+
+		static Vector add(Vector a, Vector b) { return a + b; }
+		static Vector sub(Vector a, Vector b) { return a - b; }
+		static Vector mul(Vector a, Vector b) { return a * b; }
+		static Vector div(Vector a, Vector b) { return a / b; }
+		static Vector sqrt(Vector v) { return std::sqrt(v); }
+		static Vector abs(Vector v) { return std::fabs(v); }
+		/// The sum of the elements.
+		static double sum(Vector v) { return v; }
+
+		/// False if any of them is NaN.
+		static bool all_within(Vector v, double low, double high) { return v >= low && v <= high; }
+		static Mask greater(Vector a, Vector b) { return a > b; }
+		static Vector select(Mask m, Vector a, Vector b) { return m ? a : b; }
+
+		/// Whether the integer that was rounded into q is odd.
+		static Mask odd(Vector q) { return bits_of(q) & 1; }
+		/// Flips the sign of v if the second bit of the integer in q is set.
+		static Vector flip_sign(Vector v, Vector q) { return from_bits(bits_of(v) ^ (bits_of(q) & 2) << 62); }
+		/// v with the sign of s.
+		static Vector copy_sign(Vector v, Vector s) { return std::copysign(v, s); }
+		/// The (unbiased) exponent and the mantissa (in [1, 2)) of a positive normal number.
+		static Vector exponent(Vector x) { return from_bits(bits_of(x) >> 52 | EXPONENT_OFFSET_BITS) - (4503599627370496.0 + 1023); }
+		static Vector mantissa(Vector x) { return from_bits((bits_of(x) & MANTISSA_BITS) | ONE_BITS); }
+		/// 2 to the integer that was rounded into q.
+		static Vector power_of_two(Vector q) { return from_bits((bits_of(q) - ROUNDING_BITS + 1023) << 52); }
+		/// a * b - p exactly, where p is a * b rounded.
+		static Vector product_error(Vector a, Vector b, Vector p) { return std::fma(a, b, -p); }
+	};
+
+	/// The operations of the kernels over floats, which only sqrt, sin and cos have.
+	struct Scalar_Float
+	{
+		typedef float Element;
+		typedef float Vector;
+		typedef bool Mask;
+
+		static const size_t WIDTH = 1;
+
+		static Vector load(const float* p) { return *p; }
+		static void store(float* p, Vector v) { *p = v; }
+		static Vector set(float v) { return v; }
+
+		static Vector add(Vector a, Vector b) { return a + b; }
+		static Vector sub(Vector a, Vector b) { return a - b; }
+		static Vector mul(Vector a, Vector b) { return a * b; }
+		static Vector sqrt(Vector v) { return std::sqrt(v); }
+
+		static bool all_within(Vector v, float low, float high) { return v >= low && v <= high; }
+		static Vector select(Mask m, Vector a, Vector b) { return m ? a : b; }
+
+		static Mask odd(Vector q) { return bits_of(q) & 1; }
+		static Vector flip_sign(Vector v, Vector q) { return from_bits(bits_of(v) ^ (bits_of(q) & 2) << 30); }
+		static Vector copy_sign(Vector v, Vector s) { return std::copysign(v, s); }
+	};
+
+#ifdef THISFUNC_SIMD
+	struct Sse2
+	{
+		typedef double Element;
+		typedef __m128d Vector;
+		typedef __m128d Mask;
+
+		static const size_t WIDTH = 2;
+
+		static Vector load(const double* p) { return _mm_loadu_pd(p); }
+		static void store(double* p, Vector v) { _mm_storeu_pd(p, v); }
+		static Vector set(double v) { return _mm_set1_pd(v); }
+
+		static Vector add(Vector a, Vector b) { return _mm_add_pd(a, b); }
+		static Vector sub(Vector a, Vector b) { return _mm_sub_pd(a, b); }
+		static Vector mul(Vector a, Vector b) { return _mm_mul_pd(a, b); }
+		static Vector div(Vector a, Vector b) { return _mm_div_pd(a, b); }
+		static Vector sqrt(Vector v) { return _mm_sqrt_pd(v); }
+		static Vector abs(Vector v) { return _mm_andnot_pd(_mm_set1_pd(-0.0), v); }
+		static double sum(Vector v) { return _mm_cvtsd_f64(_mm_add_sd(v, _mm_unpackhi_pd(v, v))); }
+
+		static bool all_within(Vector v, double low, double high)
+		{
+			return _mm_movemask_pd(_mm_and_pd(_mm_cmpge_pd(v, _mm_set1_pd(low)), _mm_cmple_pd(v, _mm_set1_pd(high)))) == 3;
+		}
+		static Mask greater(Vector a, Vector b) { return _mm_cmpgt_pd(a, b); }
+		static Vector select(Mask m, Vector a, Vector b) { return _mm_or_pd(_mm_and_pd(m, a), _mm_andnot_pd(m, b)); }
+
+		static Mask odd(Vector q)
+		{
+			__m128i bit = _mm_and_si128(_mm_castpd_si128(q), _mm_set1_epi64x(1));
+			return _mm_castsi128_pd(_mm_sub_epi64(_mm_setzero_si128(), bit));
+		}
+		static Vector flip_sign(Vector v, Vector q)
+		{
+			__m128i sign = _mm_slli_epi64(_mm_and_si128(_mm_castpd_si128(q), _mm_set1_epi64x(2)), 62);
+			return _mm_xor_pd(v, _mm_castsi128_pd(sign));
+		}
+		static Vector copy_sign(Vector v, Vector s) { return _mm_or_pd(_mm_andnot_pd(_mm_set1_pd(-0.0), v), _mm_and_pd(_mm_set1_pd(-0.0), s)); }
+		static Vector exponent(Vector x)
+		{
+			__m128i biased = _mm_or_si128(_mm_srli_epi64(_mm_castpd_si128(x), 52), _mm_set1_epi64x(EXPONENT_OFFSET_BITS));
+			return _mm_sub_pd(_mm_castsi128_pd(biased), _mm_set1_pd(4503599627370496.0 + 1023));
+		}
+		static Vector mantissa(Vector x)
+		{
+			__m128i bits = _mm_and_si128(_mm_castpd_si128(x), _mm_set1_epi64x(MANTISSA_BITS));
+			return _mm_castsi128_pd(_mm_or_si128(bits, _mm_set1_epi64x(ONE_BITS)));
+		}
+		static Vector power_of_two(Vector q)
+		{
+			__m128i n = _mm_sub_epi64(_mm_castpd_si128(q), _mm_set1_epi64x(ROUNDING_BITS - 1023));
+			return _mm_castsi128_pd(_mm_slli_epi64(n, 52));
+		}
+#ifdef __FMA__
+		static Vector product_error(Vector a, Vector b, Vector p) { return _mm_fmsub_pd(a, b, p); }
+#else
+		/// Without FMA the operands get split into halves whose products are exact (Dekker).
+		static Vector product_error(Vector a, Vector b, Vector p)
+		{
+			Vector a_split = _mm_mul_pd(a, _mm_set1_pd(SPLIT));
+			Vector b_split = _mm_mul_pd(b, _mm_set1_pd(SPLIT));
+			Vector a_high = _mm_sub_pd(a_split, _mm_sub_pd(a_split, a));
+			Vector b_high = _mm_sub_pd(b_split, _mm_sub_pd(b_split, b));
+			Vector a_low = _mm_sub_pd(a, a_high);
+			Vector b_low = _mm_sub_pd(b, b_high);
+			Vector error = _mm_add_pd(_mm_add_pd(_mm_sub_pd(_mm_mul_pd(a_high, b_high), p), _mm_mul_pd(a_high, b_low)), _mm_mul_pd(a_low, b_high));
+
+			return _mm_add_pd(error, _mm_mul_pd(a_low, b_low));
+		}
+#endif
+	};
+
+	// The vectors of AVX2 and AVX-512 are wrapped in a struct. The kernel templates are compiled without those instruction sets
+	// and would otherwise take and return them in registers whose use depends on the target (-Wpsabi). The wrapped ones
+	// go through memory, which costs nothing since everything gets inlined into the target functions below.
+
+	struct Avx2
+	{
+		typedef double Element;
+		struct Vector { __m256d m_value; };
+		typedef Vector Mask;
+
+		static const size_t WIDTH = 4;
+
+		THISFUNC_AVX2 static Vector load(const double* p) { return { _mm256_loadu_pd(p) }; }
+		THISFUNC_AVX2 static void store(double* p, const Vector& v) { _mm256_storeu_pd(p, v.m_value); }
+		THISFUNC_AVX2 static Vector set(double v) { return { _mm256_set1_pd(v) }; }
+
+		THISFUNC_AVX2 static Vector add(const Vector& a, const Vector& b) { return { _mm256_add_pd(a.m_value, b.m_value) }; }
+		THISFUNC_AVX2 static Vector sub(const Vector& a, const Vector& b) { return { _mm256_sub_pd(a.m_value, b.m_value) }; }
+		THISFUNC_AVX2 static Vector mul(const Vector& a, const Vector& b) { return { _mm256_mul_pd(a.m_value, b.m_value) }; }
+		THISFUNC_AVX2 static Vector div(const Vector& a, const Vector& b) { return { _mm256_div_pd(a.m_value, b.m_value) }; }
+		THISFUNC_AVX2 static Vector sqrt(const Vector& v) { return { _mm256_sqrt_pd(v.m_value) }; }
+		THISFUNC_AVX2 static Vector abs(const Vector& v) { return { _mm256_andnot_pd(_mm256_set1_pd(-0.0), v.m_value) }; }
+		THISFUNC_AVX2 static double sum(const Vector& v)
+		{
+			__m128d half = _mm_add_pd(_mm256_castpd256_pd128(v.m_value), _mm256_extractf128_pd(v.m_value, 1));
+			return _mm_cvtsd_f64(_mm_add_sd(half, _mm_unpackhi_pd(half, half)));
+		}
+
+		THISFUNC_AVX2 static bool all_within(const Vector& v, double low, double high)
+		{
+			__m256d inside = _mm256_and_pd(_mm256_cmp_pd(v.m_value, _mm256_set1_pd(low), _CMP_GE_OQ), _mm256_cmp_pd(v.m_value, _mm256_set1_pd(high), _CMP_LE_OQ));
+			return _mm256_movemask_pd(inside) == 15;
+		}
+		THISFUNC_AVX2 static Mask greater(const Vector& a, const Vector& b) { return { _mm256_cmp_pd(a.m_value, b.m_value, _CMP_GT_OQ) }; }
+		THISFUNC_AVX2 static Vector select(const Mask& m, const Vector& a, const Vector& b) { return { _mm256_blendv_pd(b.m_value, a.m_value, m.m_value) }; }
+
+		THISFUNC_AVX2 static Mask odd(const Vector& q)
+		{
+			__m256i bit = _mm256_and_si256(_mm256_castpd_si256(q.m_value), _mm256_set1_epi64x(1));
+			return { _mm256_castsi256_pd(_mm256_sub_epi64(_mm256_setzero_si256(), bit)) };
+		}
+		THISFUNC_AVX2 static Vector flip_sign(const Vector& v, const Vector& q)
+		{
+			__m256i sign = _mm256_slli_epi64(_mm256_and_si256(_mm256_castpd_si256(q.m_value), _mm256_set1_epi64x(2)), 62);
+			return { _mm256_xor_pd(v.m_value, _mm256_castsi256_pd(sign)) };
+		}
+		THISFUNC_AVX2 static Vector copy_sign(const Vector& v, const Vector& s)
+		{
+			__m256d sign = _mm256_set1_pd(-0.0);
+			return { _mm256_or_pd(_mm256_andnot_pd(sign, v.m_value), _mm256_and_pd(sign, s.m_value)) };
+		}
+		THISFUNC_AVX2 static Vector exponent(const Vector& x)
+		{
+			__m256i biased = _mm256_or_si256(_mm256_srli_epi64(_mm256_castpd_si256(x.m_value), 52), _mm256_set1_epi64x(EXPONENT_OFFSET_BITS));
+			return { _mm256_sub_pd(_mm256_castsi256_pd(biased), _mm256_set1_pd(4503599627370496.0 + 1023)) };
+		}
+		THISFUNC_AVX2 static Vector mantissa(const Vector& x)
+		{
+			__m256i bits = _mm256_and_si256(_mm256_castpd_si256(x.m_value), _mm256_set1_epi64x(MANTISSA_BITS));
+			return { _mm256_castsi256_pd(_mm256_or_si256(bits, _mm256_set1_epi64x(ONE_BITS))) };
+		}
+		THISFUNC_AVX2 static Vector power_of_two(const Vector& q)
+		{
+			__m256i n = _mm256_sub_epi64(_mm256_castpd_si256(q.m_value), _mm256_set1_epi64x(ROUNDING_BITS - 1023));
+			return { _mm256_castsi256_pd(_mm256_slli_epi64(n, 52)) };
+		}
+		THISFUNC_AVX2 static Vector product_error(const Vector& a, const Vector& b, const Vector& p) { return { _mm256_fmsub_pd(a.m_value, b.m_value, p.m_value) }; }
+	};
+
+	// The masked forms of the AVX-512 intrinsics (with every lane on) are used where the plain ones start from an undefined
+	// vector, which GCC takes for an uninitialized variable.
+	const __mmask8 ALL_LANES = 0xFF;
+
+	struct Avx512
+	{
+		typedef double Element;
+		struct Vector { __m512d m_value; };
+		typedef __mmask8 Mask;
+
+		static const size_t WIDTH = 8;
+
+		THISFUNC_AVX512 static Vector load(const double* p) { return { _mm512_loadu_pd(p) }; }
+		THISFUNC_AVX512 static void store(double* p, const Vector& v) { _mm512_storeu_pd(p, v.m_value); }
+		THISFUNC_AVX512 static Vector set(double v) { return { _mm512_set1_pd(v) }; }
+
+		THISFUNC_AVX512 static Vector add(const Vector& a, const Vector& b) { return { _mm512_add_pd(a.m_value, b.m_value) }; }
+		THISFUNC_AVX512 static Vector sub(const Vector& a, const Vector& b) { return { _mm512_sub_pd(a.m_value, b.m_value) }; }
+		THISFUNC_AVX512 static Vector mul(const Vector& a, const Vector& b) { return { _mm512_mul_pd(a.m_value, b.m_value) }; }
+		THISFUNC_AVX512 static Vector div(const Vector& a, const Vector& b) { return { _mm512_div_pd(a.m_value, b.m_value) }; }
+		THISFUNC_AVX512 static Vector sqrt(const Vector& v) { return { _mm512_maskz_sqrt_pd(ALL_LANES, v.m_value) }; }
+		THISFUNC_AVX512 static Vector abs(const Vector& v)
+		{
+			return { _mm512_castsi512_pd(_mm512_and_si512(_mm512_castpd_si512(v.m_value), _mm512_set1_epi64(~SIGN_BITS))) };
+		}
+		THISFUNC_AVX512 static double sum(const Vector& v)
+		{
+			__m256d half = _mm256_add_pd(_mm512_maskz_extractf64x4_pd(ALL_LANES, v.m_value, 0), _mm512_maskz_extractf64x4_pd(ALL_LANES, v.m_value, 1));
+			__m128d quarter = _mm_add_pd(_mm256_castpd256_pd128(half), _mm256_extractf128_pd(half, 1));
+			return _mm_cvtsd_f64(_mm_add_sd(quarter, _mm_unpackhi_pd(quarter, quarter)));
+		}
+
+		THISFUNC_AVX512 static bool all_within(const Vector& v, double low, double high)
+		{
+			return (_mm512_cmp_pd_mask(v.m_value, _mm512_set1_pd(low), _CMP_GE_OQ) & _mm512_cmp_pd_mask(v.m_value, _mm512_set1_pd(high), _CMP_LE_OQ)) == 0xFF;
+		}
+		THISFUNC_AVX512 static Mask greater(const Vector& a, const Vector& b) { return _mm512_cmp_pd_mask(a.m_value, b.m_value, _CMP_GT_OQ); }
+		THISFUNC_AVX512 static Vector select(Mask m, const Vector& a, const Vector& b) { return { _mm512_mask_blend_pd(m, b.m_value, a.m_value) }; }
+
+		THISFUNC_AVX512 static Mask odd(const Vector& q) { return _mm512_test_epi64_mask(_mm512_castpd_si512(q.m_value), _mm512_set1_epi64(1)); }
+		THISFUNC_AVX512 static Vector flip_sign(const Vector& v, const Vector& q)
+		{
+			__m512i sign = _mm512_maskz_slli_epi64(ALL_LANES, _mm512_and_si512(_mm512_castpd_si512(q.m_value), _mm512_set1_epi64(2)), 62);
+			return { _mm512_castsi512_pd(_mm512_xor_si512(_mm512_castpd_si512(v.m_value), sign)) };
+		}
+		THISFUNC_AVX512 static Vector copy_sign(const Vector& v, const Vector& s)
+		{
+			// Selects the sign bit from s and the rest from v.
+			__m512i bits = _mm512_ternarylogic_epi64(_mm512_set1_epi64(SIGN_BITS), _mm512_castpd_si512(s.m_value), _mm512_castpd_si512(v.m_value), 0xCA);
+			return { _mm512_castsi512_pd(bits) };
+		}
+		THISFUNC_AVX512 static Vector exponent(const Vector& x)
+		{
+			__m512i biased = _mm512_or_si512(_mm512_maskz_srli_epi64(ALL_LANES, _mm512_castpd_si512(x.m_value), 52), _mm512_set1_epi64(EXPONENT_OFFSET_BITS));
+			return { _mm512_sub_pd(_mm512_castsi512_pd(biased), _mm512_set1_pd(4503599627370496.0 + 1023)) };
+		}
+		THISFUNC_AVX512 static Vector mantissa(const Vector& x)
+		{
+			__m512i bits = _mm512_and_si512(_mm512_castpd_si512(x.m_value), _mm512_set1_epi64(MANTISSA_BITS));
+			return { _mm512_castsi512_pd(_mm512_or_si512(bits, _mm512_set1_epi64(ONE_BITS))) };
+		}
+		THISFUNC_AVX512 static Vector power_of_two(const Vector& q)
+		{
+			__m512i n = _mm512_sub_epi64(_mm512_castpd_si512(q.m_value), _mm512_set1_epi64(ROUNDING_BITS - 1023));
+			return { _mm512_castsi512_pd(_mm512_maskz_slli_epi64(ALL_LANES, n, 52)) };
+		}
+		THISFUNC_AVX512 static Vector product_error(const Vector& a, const Vector& b, const Vector& p) { return { _mm512_fmsub_pd(a.m_value, b.m_value, p.m_value) }; }
+	};
+
+	// The same over floats, twice as many to a vector.
+
+	struct Sse2_Float
+	{
+		typedef float Element;
+		typedef __m128 Vector;
+		typedef __m128 Mask;
+
+		static const size_t WIDTH = 4;
+
+		static Vector load(const float* p) { return _mm_loadu_ps(p); }
+		static void store(float* p, Vector v) { _mm_storeu_ps(p, v); }
+		static Vector set(float v) { return _mm_set1_ps(v); }
+
+		static Vector add(Vector a, Vector b) { return _mm_add_ps(a, b); }
+		static Vector sub(Vector a, Vector b) { return _mm_sub_ps(a, b); }
+		static Vector mul(Vector a, Vector b) { return _mm_mul_ps(a, b); }
+		static Vector sqrt(Vector v) { return _mm_sqrt_ps(v); }
+
+		static bool all_within(Vector v, float low, float high)
+		{
+			return _mm_movemask_ps(_mm_and_ps(_mm_cmpge_ps(v, _mm_set1_ps(low)), _mm_cmple_ps(v, _mm_set1_ps(high)))) == 15;
+		}
+		static Vector select(Mask m, Vector a, Vector b) { return _mm_or_ps(_mm_and_ps(m, a), _mm_andnot_ps(m, b)); }
+
+		static Mask odd(Vector q)
+		{
+			__m128i bit = _mm_and_si128(_mm_castps_si128(q), _mm_set1_epi32(1));
+			return _mm_castsi128_ps(_mm_sub_epi32(_mm_setzero_si128(), bit));
+		}
+		static Vector flip_sign(Vector v, Vector q)
+		{
+			__m128i sign = _mm_slli_epi32(_mm_and_si128(_mm_castps_si128(q), _mm_set1_epi32(2)), 30);
+			return _mm_xor_ps(v, _mm_castsi128_ps(sign));
+		}
+		static Vector copy_sign(Vector v, Vector s) { return _mm_or_ps(_mm_andnot_ps(_mm_set1_ps(-0.0f), v), _mm_and_ps(_mm_set1_ps(-0.0f), s)); }
+	};
+
+	struct Avx2_Float
+	{
+		typedef float Element;
+		struct Vector { __m256 m_value; };
+		typedef Vector Mask;
+
+		static const size_t WIDTH = 8;
+
+		THISFUNC_AVX2 static Vector load(const float* p) { return { _mm256_loadu_ps(p) }; }
+		THISFUNC_AVX2 static void store(float* p, const Vector& v) { _mm256_storeu_ps(p, v.m_value); }
+		THISFUNC_AVX2 static Vector set(float v) { return { _mm256_set1_ps(v) }; }
+
+		THISFUNC_AVX2 static Vector add(const Vector& a, const Vector& b) { return { _mm256_add_ps(a.m_value, b.m_value) }; }
+		THISFUNC_AVX2 static Vector sub(const Vector& a, const Vector& b) { return { _mm256_sub_ps(a.m_value, b.m_value) }; }
+		THISFUNC_AVX2 static Vector mul(const Vector& a, const Vector& b) { return { _mm256_mul_ps(a.m_value, b.m_value) }; }
+		THISFUNC_AVX2 static Vector sqrt(const Vector& v) { return { _mm256_sqrt_ps(v.m_value) }; }
+
+		THISFUNC_AVX2 static bool all_within(const Vector& v, float low, float high)
+		{
+			__m256 inside = _mm256_and_ps(_mm256_cmp_ps(v.m_value, _mm256_set1_ps(low), _CMP_GE_OQ), _mm256_cmp_ps(v.m_value, _mm256_set1_ps(high), _CMP_LE_OQ));
+			return _mm256_movemask_ps(inside) == 0xFF;
+		}
+		THISFUNC_AVX2 static Vector select(const Mask& m, const Vector& a, const Vector& b) { return { _mm256_blendv_ps(b.m_value, a.m_value, m.m_value) }; }
+
+		THISFUNC_AVX2 static Mask odd(const Vector& q)
+		{
+			__m256i bit = _mm256_and_si256(_mm256_castps_si256(q.m_value), _mm256_set1_epi32(1));
+			return { _mm256_castsi256_ps(_mm256_sub_epi32(_mm256_setzero_si256(), bit)) };
+		}
+		THISFUNC_AVX2 static Vector flip_sign(const Vector& v, const Vector& q)
+		{
+			__m256i sign = _mm256_slli_epi32(_mm256_and_si256(_mm256_castps_si256(q.m_value), _mm256_set1_epi32(2)), 30);
+			return { _mm256_xor_ps(v.m_value, _mm256_castsi256_ps(sign)) };
+		}
+		THISFUNC_AVX2 static Vector copy_sign(const Vector& v, const Vector& s)
+		{
+			__m256 sign = _mm256_set1_ps(-0.0f);
+			return { _mm256_or_ps(_mm256_andnot_ps(sign, v.m_value), _mm256_and_ps(sign, s.m_value)) };
+		}
+	};
+
+	const __mmask16 ALL_FLOAT_LANES = 0xFFFF;
+
+	struct Avx512_Float
+	{
+		typedef float Element;
+		struct Vector { __m512 m_value; };
+		typedef __mmask16 Mask;
+
+		static const size_t WIDTH = 16;
+
+		THISFUNC_AVX512 static Vector load(const float* p) { return { _mm512_loadu_ps(p) }; }
+		THISFUNC_AVX512 static void store(float* p, const Vector& v) { _mm512_storeu_ps(p, v.m_value); }
+		THISFUNC_AVX512 static Vector set(float v) { return { _mm512_set1_ps(v) }; }
+
+		THISFUNC_AVX512 static Vector add(const Vector& a, const Vector& b) { return { _mm512_add_ps(a.m_value, b.m_value) }; }
+		THISFUNC_AVX512 static Vector sub(const Vector& a, const Vector& b) { return { _mm512_sub_ps(a.m_value, b.m_value) }; }
+		THISFUNC_AVX512 static Vector mul(const Vector& a, const Vector& b) { return { _mm512_mul_ps(a.m_value, b.m_value) }; }
+		THISFUNC_AVX512 static Vector sqrt(const Vector& v) { return { _mm512_maskz_sqrt_ps(ALL_FLOAT_LANES, v.m_value) }; }
+
+		THISFUNC_AVX512 static bool all_within(const Vector& v, float low, float high)
+		{
+			return (_mm512_cmp_ps_mask(v.m_value, _mm512_set1_ps(low), _CMP_GE_OQ) & _mm512_cmp_ps_mask(v.m_value, _mm512_set1_ps(high), _CMP_LE_OQ)) == ALL_FLOAT_LANES;
+		}
+		THISFUNC_AVX512 static Vector select(Mask m, const Vector& a, const Vector& b) { return { _mm512_mask_blend_ps(m, b.m_value, a.m_value) }; }
+
+		THISFUNC_AVX512 static Mask odd(const Vector& q) { return _mm512_test_epi32_mask(_mm512_castps_si512(q.m_value), _mm512_set1_epi32(1)); }
+		THISFUNC_AVX512 static Vector flip_sign(const Vector& v, const Vector& q)
+		{
+			__m512i sign = _mm512_maskz_slli_epi32(ALL_FLOAT_LANES, _mm512_and_si512(_mm512_castps_si512(q.m_value), _mm512_set1_epi32(2)), 30);
+			return { _mm512_castsi512_ps(_mm512_xor_si512(_mm512_castps_si512(v.m_value), sign)) };
+		}
+		THISFUNC_AVX512 static Vector copy_sign(const Vector& v, const Vector& s)
+		{
+			__m512i bits = _mm512_ternarylogic_epi32(_mm512_set1_epi32((int)0x80000000), _mm512_castps_si512(s.m_value), _mm512_castps_si512(v.m_value), 0xCA);
+			return { _mm512_castsi512_ps(bits) };
+		}
+	};
+#endif
+
+	// The kernels go over the full vectors and return how many elements they did. The rest is left to Scalar.
+
+	template<class V>
+	size_t square_root(const typename V::Element* input, typename V::Element* output, size_t count)
+	{
+		size_t i = 0;
+
+		for (; i + V::WIDTH <= count; i += V::WIDTH)
+		{
+			V::store(output + i, V::sqrt(V::load(input + i)));
+		}
+
+		return i;
+	}
+
+	template<class V>
+	size_t sin_cos(const double* input, double* output, size_t count, bool cosine)
+	{
+		typedef typename V::Vector Vector;
+
+		size_t i = 0;
+
+		for (; i + V::WIDTH <= count; i += V::WIDTH)
+		{
+			Vector x = V::load(input + i);
+
+			// The reduction is not precise enough for huge numbers (and does not handle NaN and infinity).
+			if (!V::all_within(x, -REDUCTION_LIMIT, REDUCTION_LIMIT))
+			{
+				for (size_t j = i; j < i + V::WIDTH; ++j)
+				{
+					output[j] = cosine ? std::cos(input[j]) : std::sin(input[j]);
+				}
+				continue;
+			}
+
+			Vector q = V::add(V::mul(x, V::set(TWO_OVER_PI)), V::set(ROUNDING));
+			Vector k = V::sub(q, V::set(ROUNDING));
+			Vector r = V::sub(V::sub(V::sub(x, V::mul(k, V::set(PIO2_1))), V::mul(k, V::set(PIO2_2))), V::mul(k, V::set(PIO2_3)));
+
+			// cos(x) = sin(x + pi/2) so it is one quadrant further.
+			if (cosine)
+			{
+				q = V::add(q, V::set(1));
+			}
+
+			Vector s = V::mul(r, r);
+
+			Vector p = V::add(V::mul(V::add(V::mul(V::add(V::mul(V::add(V::mul(V::add(V::mul(V::set(S6), s), V::set(S5)), s), V::set(S4)), s), V::set(S3)), s), V::set(S2)), s), V::set(S1));
+			// sin(r) has the sign of r, which the sum would lose for -0 (S1 is negative, so the product is +0).
+			Vector sine = V::copy_sign(V::add(r, V::mul(V::mul(r, s), p)), r);
+
+			// 1 - s/2 loses the low bits of s/2 so they get added back separately.
+			Vector c = V::add(V::mul(V::add(V::mul(V::add(V::mul(V::add(V::mul(V::add(V::mul(V::set(C6), s), V::set(C5)), s), V::set(C4)), s), V::set(C3)), s), V::set(C2)), s), V::set(C1));
+			Vector half = V::mul(s, V::set(0.5));
+			Vector w = V::sub(V::set(1), half);
+			Vector cosine_r = V::add(w, V::add(V::sub(V::sub(V::set(1), w), half), V::mul(V::mul(s, s), c)));
+
+			// Quadrants 1 and 3 take the cosine of r, 2 and 3 are negative.
+			V::store(output + i, V::flip_sign(V::select(V::odd(q), cosine_r, sine), q));
+		}
+
+		return i;
+	}
+
+	/// The same over floats, with the polynomials of sinf and cosf.
+	template<class V>
+	size_t sin_cos_float(const float* input, float* output, size_t count, bool cosine)
+	{
+		typedef typename V::Vector Vector;
+
+		size_t i = 0;
+
+		for (; i + V::WIDTH <= count; i += V::WIDTH)
+		{
+			Vector x = V::load(input + i);
+
+			if (!V::all_within(x, -REDUCTION_LIMIT_FLOAT, REDUCTION_LIMIT_FLOAT))
+			{
+				for (size_t j = i; j < i + V::WIDTH; ++j)
+				{
+					output[j] = (float)(cosine ? std::cos((double)input[j]) : std::sin((double)input[j]));
+				}
+				continue;
+			}
+
+			Vector q = V::add(V::mul(x, V::set(TWO_OVER_PI_FLOAT)), V::set(ROUNDING_FLOAT));
+			Vector k = V::sub(q, V::set(ROUNDING_FLOAT));
+			Vector r = V::sub(V::sub(V::sub(x, V::mul(k, V::set(PIO2_1_FLOAT))), V::mul(k, V::set(PIO2_2_FLOAT))), V::mul(k, V::set(PIO2_3_FLOAT)));
+			r = V::sub(r, V::mul(k, V::set(PIO2_4_FLOAT)));
+
+			if (cosine)
+			{
+				q = V::add(q, V::set(1));
+			}
+
+			Vector s = V::mul(r, r);
+
+			Vector p = V::add(V::mul(V::add(V::mul(V::set(S3_FLOAT), s), V::set(S2_FLOAT)), s), V::set(S1_FLOAT));
+			Vector sine = V::copy_sign(V::add(r, V::mul(V::mul(r, s), p)), r);
+
+			Vector c = V::add(V::mul(V::add(V::mul(V::set(C3_FLOAT), s), V::set(C2_FLOAT)), s), V::set(C1_FLOAT));
+			Vector cosine_r = V::add(V::sub(V::set(1), V::mul(s, V::set(0.5f))), V::mul(V::mul(s, s), c));
+
+			V::store(output + i, V::flip_sign(V::select(V::odd(q), cosine_r, sine), q));
+		}
+
+		return i;
+	}
+
+	template<class V>
+	size_t power(const double* base, const double* exponent, double* output, size_t count)
+	{
+		typedef typename V::Vector Vector;
+
+		size_t i = 0;
+
+		for (; i + V::WIDTH <= count; i += V::WIDTH)
+		{
+			Vector x = V::load(base + i);
+			Vector y = V::load(exponent + i);
+
+			// Zero, negative, subnormal and infinite bases, and results that overflow, are all left to the standard library.
+			bool fast = V::all_within(x, DBL_MIN, DBL_MAX) && V::all_within(y, -SPLIT_LIMIT, SPLIT_LIMIT);
+			Vector t;
+			Vector t_low;
+
+			if (fast)
+			{
+				// log(x) = e * ln(2) + log(m) with m in [sqrt(2) / 2, sqrt(2)].
+				Vector e = V::exponent(x);
+				Vector m = V::mantissa(x);
+				typename V::Mask big = V::greater(m, V::set(SQRT_2));
+
+				m = V::select(big, V::mul(m, V::set(0.5)), m);
+				e = V::select(big, V::add(e, V::set(1)), e);
+
+				// log(m) = 2 * atanh(f) = 2f + 2f^3 / 3 + 2f^5 / 5 + ...
+				// y multiplies the error of log(x), and exp turns it into a relative error of the result, so log(x)
+				// is kept in two parts (high and low) wherever it gets rounded: the quotient, the sums and the product with y.
+				Vector u = V::sub(m, V::set(1));
+				Vector v = V::add(m, V::set(1));
+				Vector v_low = V::sub(u, V::sub(v, V::set(2))); // m + 1 may round, m - 1 never does.
+				Vector f = V::div(u, v);
+				Vector fv = V::mul(f, v);
+
+				// u - f * v is exact, since f * v is within an ulp of u.
+				Vector f_low = V::div(V::sub(V::sub(V::sub(u, fv), V::product_error(f, v, fv)), V::mul(f, v_low)), v);
+				Vector f2 = V::mul(f, f);
+				Vector f4 = V::mul(f2, f2);
+				Vector even = V::set(LOG_EVEN[0]);
+				Vector odd = V::set(LOG_ODD[0]);
+
+				for (size_t j = 1; j < sizeof(LOG_EVEN) / sizeof(double); ++j)
+				{
+					even = V::add(V::mul(even, f4), V::set(LOG_EVEN[j]));
+				}
+
+				for (size_t j = 1; j < sizeof(LOG_ODD) / sizeof(double); ++j)
+				{
+					odd = V::add(V::mul(odd, f4), V::set(LOG_ODD[j]));
+				}
+
+				Vector p = V::add(even, V::mul(f2, odd));
+
+				Vector twice_f = V::add(f, f);
+				Vector log_m_low = V::add(V::add(f_low, f_low), V::mul(V::mul(twice_f, f2), p));
+
+				// e * LN2_HI is exact. The high part of the sum and what its rounding lost (Knuth's two-sum).
+				Vector high = V::mul(e, V::set(LN2_HI));
+				Vector sum = V::add(high, twice_f);
+				Vector twice_f_part = V::sub(sum, high);
+				Vector lost = V::add(V::sub(high, V::sub(sum, twice_f_part)), V::sub(twice_f, twice_f_part));
+				Vector low = V::add(lost, V::add(V::mul(e, V::set(LN2_LO)), log_m_low));
+
+				// The series is in the low part, so it gets added to the high part, which is the larger one.
+				Vector log_x = V::add(sum, low);
+				Vector log_x_low = V::sub(low, V::sub(log_x, sum));
+
+				t = V::mul(y, log_x);
+				t_low = V::add(V::product_error(y, log_x, t), V::mul(y, log_x_low));
+				fast = V::all_within(t, -EXP_LIMIT, EXP_LIMIT);
+			}
+
+			if (!fast)
+			{
+				for (size_t j = i; j < i + V::WIDTH; ++j)
+				{
+					output[j] = std::pow(base[j], exponent[j]);
+				}
+				continue;
+			}
+
+			// exp(t) = 2^n * exp(r) with |r| <= ln(2) / 2. t - n * LN2_HI is exact, so the low part of t comes in after it.
+			Vector q = V::add(V::mul(t, V::set(LOG2_E)), V::set(ROUNDING));
+			Vector n = V::sub(q, V::set(ROUNDING));
+			Vector r = V::add(V::sub(t, V::mul(n, V::set(LN2_HI))), V::sub(t_low, V::mul(n, V::set(LN2_LO))));
+
+			Vector r2 = V::mul(r, r);
+			Vector even = V::set(EXP_EVEN[0]);
+			Vector odd = V::set(EXP_ODD[0]);
+
+			for (size_t j = 1; j < sizeof(EXP_EVEN) / sizeof(double); ++j)
+			{
+				even = V::add(V::mul(even, r2), V::set(EXP_EVEN[j]));
+				odd = V::add(V::mul(odd, r2), V::set(EXP_ODD[j]));
+			}
+
+			V::store(output + i, V::mul(V::add(even, V::mul(r, odd)), V::power_of_two(q)));
+		}
+
+		return i;
+	}
+
+	/// Adds the products of the full vectors to result.
+	template<class V>
+	size_t dot(const double* x, const double* y, size_t count, double& result)
+	{
+		typedef typename V::Vector Vector;
+
+		// Four sums side by side, so that an addition does not have to wait for the one before.
+		Vector s0 = V::set(0);
+		Vector s1 = V::set(0);
+		Vector s2 = V::set(0);
+		Vector s3 = V::set(0);
+		size_t i = 0;
+
+		for (; i + 4 * V::WIDTH <= count; i += 4 * V::WIDTH)
+		{
+			s0 = V::add(s0, V::mul(V::load(x + i), V::load(y + i)));
+			s1 = V::add(s1, V::mul(V::load(x + i + V::WIDTH), V::load(y + i + V::WIDTH)));
+			s2 = V::add(s2, V::mul(V::load(x + i + 2 * V::WIDTH), V::load(y + i + 2 * V::WIDTH)));
+			s3 = V::add(s3, V::mul(V::load(x + i + 3 * V::WIDTH), V::load(y + i + 3 * V::WIDTH)));
+		}
+
+		for (; i + V::WIDTH <= count; i += V::WIDTH)
+		{
+			s0 = V::add(s0, V::mul(V::load(x + i), V::load(y + i)));
+		}
+
+		result += V::sum(V::add(V::add(s0, s1), V::add(s2, s3)));
+		return i;
+	}
+
+	template<class V>
+	size_t axpy(double a, const double* x, const double* y, double* output, size_t count)
+	{
+		typename V::Vector factor = V::set(a);
+		size_t i = 0;
+
+		for (; i + V::WIDTH <= count; i += V::WIDTH)
+		{
+			V::store(output + i, V::add(V::mul(factor, V::load(x + i)), V::load(y + i)));
+		}
+
+		return i;
+	}
+
+	/// Adds the products of four rows (stride elements apart) with x to the four results. Every load of x serves all four rows.
+	template<class V>
+	size_t four_rows(const double* matrix, size_t stride, const double* x, size_t count, double* results)
+	{
+		typedef typename V::Vector Vector;
+
+		const double* r0 = matrix;
+		const double* r1 = matrix + stride;
+		const double* r2 = matrix + 2 * stride;
+		const double* r3 = matrix + 3 * stride;
+		Vector s0 = V::set(0);
+		Vector s1 = V::set(0);
+		Vector s2 = V::set(0);
+		Vector s3 = V::set(0);
+		size_t i = 0;
+
+		for (; i + V::WIDTH <= count; i += V::WIDTH)
+		{
+			Vector v = V::load(x + i);
+
+			s0 = V::add(s0, V::mul(V::load(r0 + i), v));
+			s1 = V::add(s1, V::mul(V::load(r1 + i), v));
+			s2 = V::add(s2, V::mul(V::load(r2 + i), v));
+			s3 = V::add(s3, V::mul(V::load(r3 + i), v));
+		}
+
+		results[0] += V::sum(s0);
+		results[1] += V::sum(s1);
+		results[2] += V::sum(s2);
+		results[3] += V::sum(s3);
+		return i;
+	}
+
+#ifdef THISFUNC_SIMD
+	// flatten inlines the kernel and the operations into code compiled for the instruction set.
+
+	__attribute__((flatten)) size_t square_root_sse2(const double* input, double* output, size_t count)
+	{
+		return square_root<Sse2>(input, output, count);
+	}
+
+	THISFUNC_AVX2 __attribute__((flatten)) size_t square_root_avx2(const double* input, double* output, size_t count)
+	{
+		return square_root<Avx2>(input, output, count);
+	}
+
+	THISFUNC_AVX512 __attribute__((flatten)) size_t square_root_avx512(const double* input, double* output, size_t count)
+	{
+		return square_root<Avx512>(input, output, count);
+	}
+
+	__attribute__((flatten)) size_t square_root_sse2(const float* input, float* output, size_t count)
+	{
+		return square_root<Sse2_Float>(input, output, count);
+	}
+
+	THISFUNC_AVX2 __attribute__((flatten)) size_t square_root_avx2(const float* input, float* output, size_t count)
+	{
+		return square_root<Avx2_Float>(input, output, count);
+	}
+
+	THISFUNC_AVX512 __attribute__((flatten)) size_t square_root_avx512(const float* input, float* output, size_t count)
+	{
+		return square_root<Avx512_Float>(input, output, count);
+	}
+
+	__attribute__((flatten)) size_t sin_cos_sse2(const double* input, double* output, size_t count, bool cosine)
+	{
+		return sin_cos<Sse2>(input, output, count, cosine);
+	}
+
+	THISFUNC_AVX2 __attribute__((flatten)) size_t sin_cos_avx2(const double* input, double* output, size_t count, bool cosine)
+	{
+		return sin_cos<Avx2>(input, output, count, cosine);
+	}
+
+	THISFUNC_AVX512 __attribute__((flatten)) size_t sin_cos_avx512(const double* input, double* output, size_t count, bool cosine)
+	{
+		return sin_cos<Avx512>(input, output, count, cosine);
+	}
+
+	__attribute__((flatten)) size_t sin_cos_sse2(const float* input, float* output, size_t count, bool cosine)
+	{
+		return sin_cos_float<Sse2_Float>(input, output, count, cosine);
+	}
+
+	THISFUNC_AVX2 __attribute__((flatten)) size_t sin_cos_avx2(const float* input, float* output, size_t count, bool cosine)
+	{
+		return sin_cos_float<Avx2_Float>(input, output, count, cosine);
+	}
+
+	THISFUNC_AVX512 __attribute__((flatten)) size_t sin_cos_avx512(const float* input, float* output, size_t count, bool cosine)
+	{
+		return sin_cos_float<Avx512_Float>(input, output, count, cosine);
+	}
+
+	__attribute__((flatten)) size_t power_sse2(const double* base, const double* exponent, double* output, size_t count)
+	{
+		return power<Sse2>(base, exponent, output, count);
+	}
+
+	THISFUNC_AVX2 __attribute__((flatten)) size_t power_avx2(const double* base, const double* exponent, double* output, size_t count)
+	{
+		return power<Avx2>(base, exponent, output, count);
+	}
+
+	THISFUNC_AVX512 __attribute__((flatten)) size_t power_avx512(const double* base, const double* exponent, double* output, size_t count)
+	{
+		return power<Avx512>(base, exponent, output, count);
+	}
+
+	__attribute__((flatten)) size_t dot_sse2(const double* x, const double* y, size_t count, double& result)
+	{
+		return dot<Sse2>(x, y, count, result);
+	}
+
+	THISFUNC_AVX2 __attribute__((flatten)) size_t dot_avx2(const double* x, const double* y, size_t count, double& result)
+	{
+		return dot<Avx2>(x, y, count, result);
+	}
+
+	THISFUNC_AVX512 __attribute__((flatten)) size_t dot_avx512(const double* x, const double* y, size_t count, double& result)
+	{
+		return dot<Avx512>(x, y, count, result);
+	}
+
+	__attribute__((flatten)) size_t axpy_sse2(double a, const double* x, const double* y, double* output, size_t count)
+	{
+		return axpy<Sse2>(a, x, y, output, count);
+	}
+
+	THISFUNC_AVX2 __attribute__((flatten)) size_t axpy_avx2(double a, const double* x, const double* y, double* output, size_t count)
+	{
+		return axpy<Avx2>(a, x, y, output, count);
+	}
+
+	THISFUNC_AVX512 __attribute__((flatten)) size_t axpy_avx512(double a, const double* x, const double* y, double* output, size_t count)
+	{
+		return axpy<Avx512>(a, x, y, output, count);
+	}
+
+	__attribute__((flatten)) size_t four_rows_sse2(const double* matrix, size_t stride, const double* x, size_t count, double* results)
+	{
+		return four_rows<Sse2>(matrix, stride, x, count, results);
+	}
+
+	THISFUNC_AVX2 __attribute__((flatten)) size_t four_rows_avx2(const double* matrix, size_t stride, const double* x, size_t count, double* results)
+	{
+		return four_rows<Avx2>(matrix, stride, x, count, results);
+	}
+
+	THISFUNC_AVX512 __attribute__((flatten)) size_t four_rows_avx512(const double* matrix, size_t stride, const double* x, size_t count, double* results)
+	{
+		return four_rows<Avx512>(matrix, stride, x, count, results);
+	}
+#endif
+
+	enum class Isa
+	{
+		SCALAR,
+		SSE2,
+		AVX2,
+		AVX512,
+	};
+
+	const char* ISA_NAMES[] = { "scalar", "sse2", "avx2", "avx512" };
+
+	Isa detect()
+	{
+		Isa isa = Isa::SCALAR;
+
+#ifdef THISFUNC_SIMD
+		__builtin_cpu_init();
+
+		isa = __builtin_cpu_supports("avx512f") ? Isa::AVX512
+			: __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma") ? Isa::AVX2
+			: Isa::SSE2;
+#endif
+
+		// Only ever goes down: the processor may not have what is asked for.
+		const char* forced = getenv("THISFUNC_VECTOR_ISA");
+
+		for (int i = 0; forced && i < (int)isa; ++i)
+		{
+			if (std::string(forced) == ISA_NAMES[i])
+			{
+				return (Isa)i;
+			}
+		}
+
+		return isa;
+	}
+
+	Isa isa()
+	{
+		static const Isa result = detect();
+		return result;
+	}
+}
+
+void vector_sqrt(const double* input, double* output, size_t count)
+{
+	size_t done = 0;
+
+#ifdef THISFUNC_SIMD
+	switch (isa())
+	{
+	case Isa::AVX512: done = square_root_avx512(input, output, count); break;
+	case Isa::AVX2: done = square_root_avx2(input, output, count); break;
+	case Isa::SSE2: done = square_root_sse2(input, output, count); break;
+	default: break;
+	}
+#endif
+
+	square_root<Scalar>(input + done, output + done, count - done);
+}
+
+void vector_sin(const double* input, double* output, size_t count, Accuracy accuracy)
+{
+	if (accuracy == Accuracy::EXACT)
+	{
+		for (size_t i = 0; i < count; ++i)
+		{
+			output[i] = std::sin(input[i]);
+		}
+		return;
+	}
+
+	size_t done = 0;
+
+#ifdef THISFUNC_SIMD
+	switch (isa())
+	{
+	case Isa::AVX512: done = sin_cos_avx512(input, output, count, false); break;
+	case Isa::AVX2: done = sin_cos_avx2(input, output, count, false); break;
+	case Isa::SSE2: done = sin_cos_sse2(input, output, count, false); break;
+	default: break;
+	}
+#endif
+
+	sin_cos<Scalar>(input + done, output + done, count - done, false);
+}
+
+void vector_cos(const double* input, double* output, size_t count, Accuracy accuracy)
+{
+	if (accuracy == Accuracy::EXACT)
+	{
+		for (size_t i = 0; i < count; ++i)
+		{
+			output[i] = std::cos(input[i]);
+		}
+		return;
+	}
+
+	size_t done = 0;
+
+#ifdef THISFUNC_SIMD
+	switch (isa())
+	{
+	case Isa::AVX512: done = sin_cos_avx512(input, output, count, true); break;
+	case Isa::AVX2: done = sin_cos_avx2(input, output, count, true); break;
+	case Isa::SSE2: done = sin_cos_sse2(input, output, count, true); break;
+	default: break;
+	}
+#endif
+
+	sin_cos<Scalar>(input + done, output + done, count - done, true);
+}
+
+void vector_pow(const double* base, const double* exponent, double* output, size_t count, Accuracy accuracy)
+{
+	size_t done = 0;
+
+#ifdef THISFUNC_SIMD
+	if (accuracy == Accuracy::FAST)
+	{
+		switch (isa())
+		{
+		case Isa::AVX512: done = power_avx512(base, exponent, output, count); break;
+		case Isa::AVX2: done = power_avx2(base, exponent, output, count); break;
+		case Isa::SSE2: done = power_sse2(base, exponent, output, count); break;
+		default: break;
+		}
+	}
+#endif
+
+	// One element at a time the polynomials are slower than the standard library, so the rest is always exact.
+	for (size_t i = done; i < count; ++i)
+	{
+		output[i] = std::pow(base[i], exponent[i]);
+	}
+}
+
+void vector_sqrt(const float* input, float* output, size_t count)
+{
+	size_t done = 0;
+
+#ifdef THISFUNC_SIMD
+	switch (isa())
+	{
+	case Isa::AVX512: done = square_root_avx512(input, output, count); break;
+	case Isa::AVX2: done = square_root_avx2(input, output, count); break;
+	case Isa::SSE2: done = square_root_sse2(input, output, count); break;
+	default: break;
+	}
+#endif
+
+	square_root<Scalar_Float>(input + done, output + done, count - done);
+}
+
+void vector_sin(const float* input, float* output, size_t count, Accuracy accuracy)
+{
+	if (accuracy == Accuracy::EXACT)
+	{
+		for (size_t i = 0; i < count; ++i)
+		{
+			output[i] = (float)std::sin((double)input[i]);
+		}
+		return;
+	}
+
+	size_t done = 0;
+
+#ifdef THISFUNC_SIMD
+	switch (isa())
+	{
+	case Isa::AVX512: done = sin_cos_avx512(input, output, count, false); break;
+	case Isa::AVX2: done = sin_cos_avx2(input, output, count, false); break;
+	case Isa::SSE2: done = sin_cos_sse2(input, output, count, false); break;
+	default: break;
+	}
+#endif
+
+	sin_cos_float<Scalar_Float>(input + done, output + done, count - done, false);
+}
+
+void vector_cos(const float* input, float* output, size_t count, Accuracy accuracy)
+{
+	if (accuracy == Accuracy::EXACT)
+	{
+		for (size_t i = 0; i < count; ++i)
+		{
+			output[i] = (float)std::cos((double)input[i]);
+		}
+		return;
+	}
+
+	size_t done = 0;
+
+#ifdef THISFUNC_SIMD
+	switch (isa())
+	{
+	case Isa::AVX512: done = sin_cos_avx512(input, output, count, true); break;
+	case Isa::AVX2: done = sin_cos_avx2(input, output, count, true); break;
+	case Isa::SSE2: done = sin_cos_sse2(input, output, count, true); break;
+	default: break;
+	}
+#endif
+
+	sin_cos_float<Scalar_Float>(input + done, output + done, count - done, true);
+}
+
+void vector_pow(const float* base, const float* exponent, float* output, size_t count, Accuracy accuracy)
+{
+	// A float has too few bits to carry log(x) through exp, so the elements get widened a piece at a time.
+	const size_t PIECE = 256;
+	double bases[PIECE];
+	double exponents[PIECE];
+
+	for (size_t i = 0; i < count; i += PIECE)
+	{
+		size_t size = count - i < PIECE ? count - i : PIECE;
+
+		std::copy(base + i, base + i + size, bases);
+		std::copy(exponent + i, exponent + i + size, exponents);
+		vector_pow(bases, exponents, bases, size, accuracy);
+		std::copy(bases, bases + size, output + i);
+	}
+}
+
+const char* vector_isa()
+{
+	return ISA_NAMES[(int)isa()];
+}
+
+double vector_dot(const double* x, const double* y, size_t count)
+{
+	double result = 0;
+	size_t done = 0;
+
+#ifdef THISFUNC_SIMD
+	switch (isa())
+	{
+	case Isa::AVX512: done = dot_avx512(x, y, count, result); break;
+	case Isa::AVX2: done = dot_avx2(x, y, count, result); break;
+	case Isa::SSE2: done = dot_sse2(x, y, count, result); break;
+	default: break;
+	}
+#endif
+
+	dot<Scalar>(x + done, y + done, count - done, result);
+	return result;
+}
+
+void vector_axpy(double a, const double* x, const double* y, double* output, size_t count)
+{
+	size_t done = 0;
+
+#ifdef THISFUNC_SIMD
+	switch (isa())
+	{
+	case Isa::AVX512: done = axpy_avx512(a, x, y, output, count); break;
+	case Isa::AVX2: done = axpy_avx2(a, x, y, output, count); break;
+	case Isa::SSE2: done = axpy_sse2(a, x, y, output, count); break;
+	default: break;
+	}
+#endif
+
+	axpy<Scalar>(a, x + done, y + done, output + done, count - done);
+}
+
+void vector_matvec(const double* matrix, const double* x, double* output, size_t rows, size_t columns)
+{
+	// x goes in blocks of 2048 elements (16 KB), which stay in the first level cache while all the rows pass over them.
+	const size_t BLOCK = 2048;
+
+	std::fill(output, output + rows, 0.0);
+
+	for (size_t begin = 0; begin < columns; begin += BLOCK)
+	{
+		size_t count = columns - begin < BLOCK ? columns - begin : BLOCK;
+		size_t row = 0;
+
+		for (; row + 4 <= rows; row += 4)
+		{
+			const double* block = matrix + row * columns + begin;
+			size_t done = 0;
+
+#ifdef THISFUNC_SIMD
+			switch (isa())
+			{
+			case Isa::AVX512: done = four_rows_avx512(block, columns, x + begin, count, output + row); break;
+			case Isa::AVX2: done = four_rows_avx2(block, columns, x + begin, count, output + row); break;
+			case Isa::SSE2: done = four_rows_sse2(block, columns, x + begin, count, output + row); break;
+			default: break;
+			}
+#endif
+
+			four_rows<Scalar>(block + done, columns, x + begin + done, count - done, output + row);
+		}
+
+		for (; row < rows; ++row)
+		{
+			output[row] += vector_dot(matrix + row * columns + begin, x + begin, count);
+		}
+	}
+}
\ No newline at end of file
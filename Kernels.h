@@ -0,0 +1,42 @@
+#pragma once
+
+#include <cstddef>
+
+//#################################################
+// VECTOR KERNELS
+//#################################################
+
+/// How sin, cos and pow get computed over lists. sqrt is always exact.
+enum class Accuracy
+{
+	EXACT, /// The same results as the standard library, one element at a time.
+	FAST, /// Polynomial approximations over whole vectors.
+		  /// sin and cos are off by at most 3 ULP (for |x| < 2^20, larger ones are computed exactly) and keep the sign of zero.
+		  /// pow has a relative error below (2 + |y * log(x)| / 16) * 2^-52 (for positive bases and with SIMD, the rest are computed exactly).
+};
+
+/// Apply the builtin to every element. The input and the output may be the same buffer.
+/// The instruction set (AVX-512, AVX2 or SSE2) is picked when first needed, based on the processor.
+/// The environment variable THISFUNC_VECTOR_ISA (avx512, avx2, sse2 or scalar) can force a less capable one.
+void vector_sqrt(const double* input, double* output, size_t count);
+void vector_sin(const double* input, double* output, size_t count, Accuracy accuracy);
+void vector_cos(const double* input, double* output, size_t count, Accuracy accuracy);
+void vector_pow(const double* base, const double* exponent, double* output, size_t count, Accuracy accuracy);
+
+/// The same over floats (for --numbers float32), with twice as many elements to a vector. The exact ones round the result
+/// of the standard library in double, like the builtins on numbers. The fast sin and cos are off by at most 2 float ULP
+/// (for |x| < 8192, larger ones are computed exactly). pow computes in double either way.
+void vector_sqrt(const float* input, float* output, size_t count);
+void vector_sin(const float* input, float* output, size_t count, Accuracy accuracy);
+void vector_cos(const float* input, float* output, size_t count, Accuracy accuracy);
+void vector_pow(const float* base, const float* exponent, float* output, size_t count, Accuracy accuracy);
+
+/// The sum of x[i] * y[i], in several sums side by side (so not quite in the order of the elements).
+double vector_dot(const double* x, const double* y, size_t count);
+/// output = a * x + y, element by element. output may be y.
+void vector_axpy(double a, const double* x, const double* y, double* output, size_t count);
+/// output = matrix * x, with the matrix row after row (rows * columns elements) and x of columns elements.
+void vector_matvec(const double* matrix, const double* x, double* output, size_t rows, size_t columns);
+
+/// The name of the instruction set the kernels use.
+const char* vector_isa();
\ No newline at end of file
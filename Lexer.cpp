@@ -1,6 +1,13 @@
 #include "Lexer.h"
 #include "Parser.h"
 #include "Interpreter.h"
+#include "Trace.h"
+
+#include <algorithm>
+#include <charconv>
+#include <iomanip>
+#include <sstream>
+#include <thread>
 
 ///#################################################
 /// ERRORS
@@ -91,6 +98,11 @@ void Token::print(std::ostream & out) const
 		out << "NUMBER";
 		break;
 	}
+	case Type::TEXT:
+	{
+		out << "TEXT";
+		break;
+	}
 	default:
 		out << "UNKNOWN";
 	}
@@ -109,7 +121,16 @@ void Function_Token::print(std::ostream& out) const
 
 Number_Token::Number_Token(const double value)
 	: Token(Type::NUMBER),
-	m_value(value)
+	m_value(value),
+	m_is_integer(false),
+	m_integer(0)
+{ }
+
+Number_Token::Number_Token(const int64_t integer)
+	: Token(Type::NUMBER),
+	m_value((double)integer),
+	m_is_integer(true),
+	m_integer(integer)
 { }
 
 void Number_Token::print(std::ostream& out) const
@@ -129,6 +150,17 @@ void Argument_Token::print(std::ostream& out) const
 	out << ':' << m_value;
 }
 
+Text_Token::Text_Token(const std::string& text)
+	: Token(Type::TEXT),
+	m_text(text)
+{ }
+
+void Text_Token::print(std::ostream& out) const
+{
+	Token::print(out);
+	out << ":\"" << m_text << '"';
+}
+
 //#################################################
 // LEXER
 //#################################################
@@ -163,23 +195,18 @@ bool Lexer::make_tokens(std::vector<Token*>& tokens, std::ostream& error_output)
 
 			tokens.push_back(new Function_Token(name));
 		}
-		else if (is_digit(*it) || *it == '-') // Form a double number (can be negative and/or a fraction).
+		else if (is_digit(*it) || *it == '-') // Form a double number (can be negative, a fraction and/or have an exponent).
 		{
-			bool negative = false;
+			std::string::iterator first = it;
 
 			if (*it == '-')
 			{
-				negative = true;
 				++it;
 			}
 
-			double number = 0;
-
 			bool dot = false;
 
-			double power_10 = 1;
-
-			do
+			while (it != m_input.end() && (is_digit(*it) || *it == '.'))
 			{
 				if (*it == '.')
 				{
@@ -191,20 +218,58 @@ bool Lexer::make_tokens(std::vector<Token*>& tokens, std::ostream& error_output)
 					}
 					dot = true;
 				}
-				else
+
+				++it;
+			}
+
+			bool exponent = false;
+
+			// An exponent, as in 1e-07, which is how the results print very small and very big numbers.
+			if (it != m_input.end() && *it == 'e')
+			{
+				std::string::iterator digits = it + 1;
+
+				if (digits != m_input.end() && (*digits == '-' || *digits == '+'))
+				{
+					++digits;
+				}
+
+				if (digits != m_input.end() && is_digit(*digits))
 				{
-					number = number * 10 + *it - '0';
+					it = digits;
+					exponent = true;
 
-					if (dot == true)
+					while (it != m_input.end() && is_digit(*it))
 					{
-						power_10 *= 10;
+						++it;
 					}
 				}
+			}
 
-				++it;
-			} while (it != m_input.end() && (is_digit(*it) || *it == '.'));
+			// from_chars rounds correctly, so every printed result reads back as the same number.
+			double number;
+			const char* last = m_input.data() + (it - m_input.begin());
+			std::from_chars_result result = std::from_chars(m_input.data() + (first - m_input.begin()), last, number);
+
+			if (result.ec != std::errc() || result.ptr != last)
+			{
+				Illegal_Character(std::string() += *(it - 1), m_input, it - 1 - m_input.begin()).print(error_output);
+				tokens.clear();
+				return false;
+			}
 
-			tokens.push_back(new Number_Token(negative == true ? (number / power_10) * (-1) : number / power_10));
+			// Integers are kept exactly as well, for --numbers int64. -0 has no integer of its own and stays a double.
+			int64_t integer = 0;
+			result = std::from_chars(m_input.data() + (first - m_input.begin()), last, integer);
+
+			if (!dot && !exponent && !(number == 0 && *first == '-') && result.ec == std::errc() && result.ptr == last)
+			{
+				tokens.push_back(new Number_Token(integer));
+			}
+			else
+			{
+				tokens.push_back(new Number_Token(number));
+			}
 		}
 
 		if (it == m_input.end())
@@ -282,6 +347,23 @@ bool Lexer::make_tokens(std::vector<Token*>& tokens, std::ostream& error_output)
 			--it; // So as not to skip the next character.
 			break;
 		}
+		case '"':
+		{
+			// The text runs up to the next quote. There is no way to have a quote in it.
+			std::string::iterator last = std::find(it + 1, m_input.end(), '"');
+
+			if (last == m_input.end())
+			{
+				Error("Lexical error", "Expected '\"'").print(error_output);
+				tokens.clear();
+				return false;
+			}
+
+			tokens.push_back(new Text_Token(std::string(it + 1, last)));
+
+			it = last;
+			break;
+		}
 		default: // If nothing catches the character then it is not accepted in our language.
 		{
 			Illegal_Character(std::string() += *it, m_input, it - m_input.begin()).print(error_output);
@@ -305,53 +387,255 @@ bool Lexer::make_tokens(std::vector<Token*>& tokens, std::ostream& error_output)
 // RUN
 //#################################################
 
-void run(std::istream& in, std::ostream& out)
+Node* parse(const std::string& input, std::ostream& out)
 {
-	std::string input;
+	Lexer l(input);
 
+	std::vector<Token*> tokens; // Use an outside vector so as to have no contact between the lexer and the parser.
+								// Also, you could print the vector before passing it to the parser (for debug purposes/in another function).
+								// Also, also, you could use the vector for other purposes e.g. optimization or additional error checking.
+
+	if (!l.make_tokens(tokens, out))
+	{
+		return nullptr;
+	}
+
+	Parser p(tokens);
+
+	return p.parse(out);
+}
+
+void run(std::istream& in, std::ostream& out)
+{
 	Interpreter i; // It has to be active during the loop so as to store the user declared functions.
 
+	run(in, out, i);
+}
+
+void run(std::istream& in, std::ostream& out, Interpreter& i)
+{
+	run(in, out, i, nullptr);
+}
+
+void run(std::istream& in, std::ostream& out, Interpreter& i, Trace_Writer* trace)
+{
+	std::string input;
+
 	while (true)
 	{
 		out << "thisfunc > ";
 
-		getline(in, input);
-
-		if (input == "e0")
+		// The end of the input is as good as e0.
+		if (!getline(in, input) || input == "e0")
 		{
 			break;
 		}
 
-		Lexer l(input);
+		if (trace && input.find_first_not_of(" \t\r") != std::string::npos)
+		{
+			trace->record(input);
+		}
 
-		std::vector<Token*> tokens; // Use an outside vector so as to have no contact between the lexer and the parser.
-									// Also, you could print the vector before passing it to the parser (for debug purposes/in another function).
-									// Also, also, you could use the vector for other purposes e.g. optimization or additional error checking.
+		Node* a = parse(input, out);
 
-		if (!l.make_tokens(tokens, out))
+		if (!a)
 		{
-			continue; // If the input is not acceptable, start the loop all over again.
+			continue; // If the input or the abstract syntax tree is not acceptable, there is not point in interpreting it.
 		}
 
-		Parser p(tokens);
+		i.interpret(a, out); // Needn't check for corrections, since nothing happens after the interpretation.
+							// If there is an error, just print it and output nothing.
+
+		out << '\n';
+	}
+
+	out << "\n\n\n";
+}
 
-		for (const Token* a : tokens)
+bool run_batch(std::istream& in, std::ostream& out, Interpreter& i, bool parallel, Trace_Writer* trace)
+{
+	const size_t MAX_GROUP = 4096; // The most expressions evaluated together. Their output waits for the last of them.
+
+	std::string input;
+	bool ok = true;
+	std::vector<const Node*> group; // The expressions since the last definition, in parallel mode.
+
+	// Evaluates the group and prints what it output, in the order of the script.
+	auto flush = [&out, &i, &ok, &group]()
+	{
+		std::vector<std::string> outputs;
+		std::vector<char> succeeded;
+
+		if (group.empty())
+		{
+			return;
+		}
+
+		if (!i.interpret_parallel(group, outputs, succeeded))
+		{
+			ok = false;
+		}
+
+		for (size_t j = 0; j < group.size(); ++j)
+		{
+			out << outputs[j];
+
+			if (succeeded[j])
+			{
+				out << '\n';
+			}
+		}
+
+		group.clear();
+	};
+
+	while (getline(in, input) && input != "e0")
+	{
+		// Blank lines are there for the reader.
+		if (input.find_first_not_of(" \t\r") == std::string::npos)
+		{
+			continue;
+		}
+
+		if (trace)
 		{
-			a = nullptr;
+			trace->record(input);
 		}
 
-		Node* a = p.parse(out);
+		// A parse error has to wait for the expressions before it.
+		std::ostringstream errors;
+		Node* a = parse(input, parallel ? errors : out);
 
 		if (!a)
 		{
-			continue; // If the abstract syntax tree is not acceptable, there is not point in interpreting it.
+			flush();
+			out << errors.str() << std::flush;
+			ok = false;
+			continue;
 		}
 
-		i.interpret(a, out); // Needn't check for corrections, since nothing happens after the interpretation.
-							// If there is an error, just print it and output nothing.
+		bool definition = dynamic_cast<const User_Function*>(a) && dynamic_cast<const User_Function*>(a)->m_definition;
 
-		out << '\n';
+		// Only definitions and files being written change what the expressions after them see, so those in between can run side by side.
+		if (parallel && !definition && !i.writes_files(a))
+		{
+			group.push_back(a);
+
+			if (group.size() == MAX_GROUP)
+			{
+				flush();
+			}
+
+			continue;
+		}
+
+		flush();
+
+		if (!i.interpret(a, out))
+		{
+			out.flush();
+			ok = false;
+		}
+		else if (!definition)
+		{
+			out << '\n'; // A definition prints nothing, so it gets no line either.
+		}
 	}
 
-	out << "\n\n\n";
+	flush();
+	out.flush();
+	return ok;
+}
+
+namespace
+{
+	/// Takes whatever is written to it and keeps none of it. A stream without a buffer would be in a failed state
+	/// and skip the formatting too.
+	class Null_Buffer : public std::streambuf
+	{
+	protected:
+		int_type overflow(int_type c) override { return traits_type::not_eof(c); }
+		std::streamsize xsputn(const char*, std::streamsize count) override { return count; }
+	};
+
+	/// Prints how many there are and their percentiles, in microseconds. Sorts them.
+	void print_latencies(const char* name, std::vector<double>& latencies, std::ostream& out)
+	{
+		const double PERCENTILES[] = { 50, 90, 99, 99.9 };
+		const char* NAMES[] = { "p50", "p90", "p99", "p99.9" };
+
+		out << name << ": " << latencies.size();
+
+		if (latencies.empty())
+		{
+			out << '\n';
+			return;
+		}
+
+		std::sort(latencies.begin(), latencies.end());
+
+		// The nearest rank: the smallest latency that at least that many percent of the statements do not exceed.
+		out << std::fixed << std::setprecision(1);
+
+		for (size_t i = 0; i < 4; ++i)
+		{
+			size_t rank = (size_t)std::ceil(PERCENTILES[i] / 100 * latencies.size());
+
+			out << ", " << NAMES[i] << ' ' << latencies[rank > 0 ? rank - 1 : 0] << " us";
+		}
+
+		out << ", max " << latencies.back() << " us\n" << std::defaultfloat << std::setprecision(6);
+	}
+}
+
+bool replay(const std::string& path, Interpreter& i, bool paced, std::ostream& out)
+{
+	std::vector<Trace_Entry> entries;
+	std::string error;
+
+	if (!read_trace(path, entries, error))
+	{
+		Error("Trace error", error).print(out);
+		return false;
+	}
+
+	Null_Buffer nothing;
+	std::ostream discard(&nothing); // Printing still takes its time, but nothing comes out.
+	std::vector<double> latencies[2]; // Of the expressions and of the definitions.
+	size_t failed = 0;
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+	for (const Trace_Entry& a : entries)
+	{
+		std::chrono::steady_clock::time_point due = std::chrono::steady_clock::now();
+
+		if (paced)
+		{
+			due = start + std::chrono::microseconds(a.m_time);
+			std::this_thread::sleep_until(due);
+		}
+
+		Node* node = parse(a.m_line, discard);
+		bool definition = dynamic_cast<const User_Function*>(node) && dynamic_cast<const User_Function*>(node)->m_definition;
+
+		if (!node || !i.interpret(node, discard))
+		{
+			++failed;
+		}
+
+		latencies[definition].push_back(std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - due).count());
+	}
+
+	std::chrono::duration<double> total = std::chrono::steady_clock::now() - start;
+	std::vector<double> all(latencies[0]);
+
+	all.insert(all.end(), latencies[1].begin(), latencies[1].end());
+
+	out << "Replayed " << entries.size() << " statements (" << failed << " failed) in " << total.count() << " s\n";
+
+	print_latencies("all", all, out);
+	print_latencies("expressions", latencies[0], out);
+	print_latencies("definitions", latencies[1], out);
+
+	return failed == 0;
 }
\ No newline at end of file
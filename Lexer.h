@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstdint>
 #include <iostream>
 #include <vector>
 #include <string>
@@ -58,6 +59,7 @@ enum class Type
 
 	NUMBER,
 	ARGUMENT,
+	TEXT,
 
 	OPENING_BRACKET,
 	COMMA,
@@ -70,6 +72,8 @@ struct Token
 	Type m_type;
 
 	explicit Token(const Type type);
+	/// Tokens are deleted through this type, e.g. by the nodes that own them.
+	virtual ~Token() = default;
 
 	/// Debug function.
 	virtual void print(std::ostream& out) const;
@@ -88,8 +92,12 @@ struct Function_Token :public Token
 struct Number_Token :public Token
 {
 	double m_value;
+	bool m_is_integer; /// Written without a dot or an exponent and within int64, so that m_integer holds it exactly.
+	int64_t m_integer; /// What --numbers int64 uses, since m_value is only exact up to 2^53.
 
 	explicit Number_Token(const double value);
+	/// An integer literal. m_value is the nearest double to it.
+	explicit Number_Token(const int64_t integer);
 
 	/// Debug function.
 	void print(std::ostream& out) const override;
@@ -105,6 +113,17 @@ struct Argument_Token :public Token
 	void print(std::ostream& out) const override;
 };
 
+/// Text in quotes, such as the name of a file for load and save. It is not a value of its own.
+struct Text_Token :public Token
+{
+	std::string m_text; /// Without the quotes.
+
+	explicit Text_Token(const std::string& text);
+
+	/// Debug function.
+	void print(std::ostream& out) const override;
+};
+
 //#################################################
 // LEXER
 //#################################################
@@ -131,5 +150,27 @@ public:
 // RUN
 //#################################################
 
+struct Node;
+class Interpreter;
+class Trace_Writer;
+
+/// Runs the lexer and the parser on one line. Returns nullptr (and prints the error) if either of them fails.
+Node* parse(const std::string& input, std::ostream& out);
+
 /// The main function that does uses all the classes.
-void run(std::istream& in, std::ostream& out);
\ No newline at end of file
+void run(std::istream& in, std::ostream& out);
+/// Same as above but with an interpreter that has already been set up (e.g. has libraries loaded).
+void run(std::istream& in, std::ostream& out, Interpreter& i);
+/// Same as above, recording every line that is not blank into the trace, unless it is nullptr.
+void run(std::istream& in, std::ostream& out, Interpreter& i, Trace_Writer* trace);
+/// Runs a script without prompts: one line per result, nothing for a definition and the message of an error.
+/// Stops at the end of the input or at e0. Returns false if any of the lines failed.
+/// In parallel the expressions between two definitions (or expressions that write files) get evaluated side by side (see Interpreter::interpret_parallel),
+/// with the output still in the order of the script.
+/// The lines get recorded into the trace the same way run does, unless it is nullptr.
+bool run_batch(std::istream& in, std::ostream& out, Interpreter& i, bool parallel, Trace_Writer* trace);
+/// Feeds the lines of a trace to the interpreter, as fast as it can or paced the way they were recorded, and prints
+/// the percentiles of how long the statements took: from the time they were due, so that at the recorded pace a statement
+/// that has to wait for the one before it counts the wait as well. What the statements print is dropped.
+/// Returns false if the trace cannot be read or any of the statements failed.
+bool replay(const std::string& path, Interpreter& i, bool paced, std::ostream& out);
\ No newline at end of file
@@ -0,0 +1,305 @@
+#include "Memo.h"
+
+#include <cstring>
+#include <iterator>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define THISFUNC_MEMO_FILE
+#endif
+
+namespace
+{
+	/// Adds the bits to the hash. The arguments are often small integers, which only differ in their high bits,
+	/// so those get spread over all the others (the finalizer of splitmix64).
+	uint64_t mix(uint64_t hash, uint64_t bits)
+	{
+		hash ^= bits;
+		hash = (hash ^ (hash >> 30)) * 0xBF58476D1CE4E5B9;
+		hash = (hash ^ (hash >> 27)) * 0x94D049BB133111EB;
+		return hash ^ (hash >> 31);
+	}
+}
+
+bool Memo::Key::operator==(const Key& rhs) const
+{
+	return m_count == rhs.m_count && memcmp(m_bits, rhs.m_bits, m_count * sizeof(uint64_t)) == 0;
+}
+
+size_t Memo::Hash::operator()(const Key& key) const
+{
+	uint64_t hash = key.m_count;
+
+	for (size_t i = 0; i < key.m_count; ++i)
+	{
+		hash = mix(hash, key.m_bits[i]);
+	}
+
+	return (size_t)hash;
+}
+
+Memo::Key Memo::key_of(const double* arguments, size_t count)
+{
+	Key key;
+
+	key.m_count = count;
+	memcpy(key.m_bits, arguments, count * sizeof(double));
+
+	return key;
+}
+
+Memo::Memo(size_t capacity, Eviction eviction)
+	: m_capacity(capacity > 0 ? capacity : 1),
+	m_eviction(eviction),
+	m_hits(0),
+	m_misses(0),
+	m_evictions(0)
+{ }
+
+bool Memo::find(const double* arguments, size_t count, double& result)
+{
+	std::unordered_map<Key, Entries::iterator, Hash>::iterator it = m_index.find(key_of(arguments, count));
+
+	if (it == m_index.end())
+	{
+		++m_misses;
+		return false;
+	}
+
+	// The one just used goes to the back of the line.
+	if (m_eviction == Eviction::LRU)
+	{
+		m_entries.splice(m_entries.end(), m_entries, it->second);
+	}
+
+	++m_hits;
+	result = it->second->second;
+	return true;
+}
+
+void Memo::insert(const double* arguments, size_t count, double result)
+{
+	Key key = key_of(arguments, count);
+
+	if (m_index.count(key))
+	{
+		return;
+	}
+
+	if (m_entries.size() >= m_capacity)
+	{
+		m_index.erase(m_entries.front().first);
+		m_entries.pop_front();
+		++m_evictions;
+	}
+
+	m_entries.push_back({ key, result });
+	m_index[key] = std::prev(m_entries.end());
+}
+
+size_t Memo::hits() const
+{
+	return m_hits;
+}
+
+size_t Memo::misses() const
+{
+	return m_misses;
+}
+
+size_t Memo::evictions() const
+{
+	return m_evictions;
+}
+
+size_t Memo::size() const
+{
+	return m_entries.size();
+}
+
+Memo_File::Memo_File()
+	: m_memory(nullptr),
+	m_size(0),
+	m_slots(nullptr),
+	m_capacity(0),
+	m_hits(0),
+	m_misses(0)
+{ }
+
+Memo_File::~Memo_File()
+{
+#ifdef THISFUNC_MEMO_FILE
+	if (m_memory)
+	{
+		munmap(m_memory, m_size);
+	}
+#endif
+}
+
+bool Memo_File::open(const std::string& path)
+{
+#ifdef THISFUNC_MEMO_FILE
+	int file = ::open(path.c_str(), O_RDWR);
+
+	// A new file is made on the side and linked into place, so that nobody ever maps one that is half made.
+	// If another process wins the race, its file is the one used.
+	if (file < 0)
+	{
+		std::string temporary = path + "." + std::to_string(getpid());
+		Header header = { MAGIC, VERSION, DEFAULT_CAPACITY, {} };
+
+		file = ::open(temporary.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+
+		if (file < 0)
+		{
+			return false;
+		}
+
+		bool made = ftruncate(file, sizeof(Header) + DEFAULT_CAPACITY * sizeof(Slot)) == 0
+			&& pwrite(file, &header, sizeof(header), 0) == (ssize_t)sizeof(header);
+
+		close(file);
+
+		if (made)
+		{
+			link(temporary.c_str(), path.c_str());
+		}
+
+		unlink(temporary.c_str());
+
+		file = ::open(path.c_str(), O_RDWR);
+
+		if (file < 0)
+		{
+			return false;
+		}
+	}
+
+	struct stat status;
+	Header header;
+
+	if (fstat(file, &status) != 0 || pread(file, &header, sizeof(header), 0) != (ssize_t)sizeof(header)
+		|| header.m_magic != MAGIC || header.m_version != VERSION
+		|| (uint64_t)status.st_size != sizeof(Header) + header.m_capacity * sizeof(Slot) || header.m_capacity == 0)
+	{
+		close(file);
+		return false;
+	}
+
+	void* memory = mmap(nullptr, status.st_size, PROT_READ | PROT_WRITE, MAP_SHARED, file, 0);
+
+	close(file); // The mapping keeps the file.
+
+	if (memory == MAP_FAILED)
+	{
+		return false;
+	}
+
+	if (m_memory)
+	{
+		munmap(m_memory, m_size);
+	}
+
+	m_memory = memory;
+	m_size = status.st_size;
+	m_slots = (Slot*)((char*)memory + sizeof(Header));
+	m_capacity = header.m_capacity;
+	return true;
+#else
+	return false;
+#endif
+}
+
+bool Memo_File::is_open() const
+{
+	return m_slots != nullptr;
+}
+
+uint64_t Memo_File::key_of(uint64_t function, const double* arguments, size_t count)
+{
+	uint64_t hash = function ^ count;
+
+	for (size_t i = 0; i < count; ++i)
+	{
+		uint64_t bits;
+		memcpy(&bits, arguments + i, sizeof(bits));
+
+		hash = mix(hash, bits);
+	}
+
+	// EMPTY and BUSY are taken.
+	return hash > BUSY ? hash : hash + 2;
+}
+
+bool Memo_File::holds(const Slot& slot, uint64_t function, const double* arguments, size_t count)
+{
+	return slot.m_function == function && slot.m_count == count && memcmp(slot.m_arguments, arguments, count * sizeof(double)) == 0;
+}
+
+bool Memo_File::find(uint64_t function, const double* arguments, size_t count, double& result)
+{
+	uint64_t key = key_of(function, arguments, count);
+
+	for (size_t i = 0; i < MAX_PROBES; ++i)
+	{
+		const Slot& slot = m_slots[(key + i) % m_capacity];
+		uint64_t current = slot.m_key.load(std::memory_order_acquire);
+
+		if (current == EMPTY)
+		{
+			break;
+		}
+
+		if (current == key && holds(slot, function, arguments, count))
+		{
+			++m_hits;
+			result = slot.m_result;
+			return true;
+		}
+	}
+
+	++m_misses;
+	return false;
+}
+
+void Memo_File::insert(uint64_t function, const double* arguments, size_t count, double result)
+{
+	uint64_t key = key_of(function, arguments, count);
+
+	for (size_t i = 0; i < MAX_PROBES; ++i)
+	{
+		Slot& slot = m_slots[(key + i) % m_capacity];
+		uint64_t current = EMPTY;
+
+		if (slot.m_key.compare_exchange_strong(current, BUSY, std::memory_order_acquire))
+		{
+			slot.m_function = function;
+			slot.m_count = count;
+			memcpy(slot.m_arguments, arguments, count * sizeof(double));
+			slot.m_result = result;
+
+			// Publishing the key last makes the rest visible to whoever sees it.
+			slot.m_key.store(key, std::memory_order_release);
+			return;
+		}
+
+		// Another process may have computed the same call meanwhile.
+		if (current == key && holds(slot, function, arguments, count))
+		{
+			return;
+		}
+	}
+}
+
+size_t Memo_File::hits() const
+{
+	return m_hits;
+}
+
+size_t Memo_File::misses() const
+{
+	return m_misses;
+}
\ No newline at end of file
@@ -0,0 +1,130 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <atomic>
+#include <list>
+#include <string>
+#include <unordered_map>
+
+//#################################################
+// MEMO
+//#################################################
+
+/// Which entry a full memo table drops to make room for a new one.
+enum class Eviction
+{
+	LRU, /// The one used the longest time ago.
+	FIFO, /// The one stored first. A hit does not have to reorder anything.
+};
+
+/// The results of a pure function by its arguments, at most a fixed number of them.
+class Memo
+{
+public:
+	/// Functions with more arguments are not memoized.
+	static const size_t MAX_ARITY = 8;
+
+private:
+	struct Key
+	{
+		uint64_t m_bits[MAX_ARITY]; /// The arguments bit by bit, so that NaN finds itself and 0 and -0 stay apart.
+		size_t m_count;
+
+		bool operator==(const Key& rhs) const;
+	};
+
+	struct Hash
+	{
+		size_t operator()(const Key& key) const;
+	};
+
+	typedef std::list<std::pair<Key, double>> Entries;
+
+	Entries m_entries; /// In the order they get evicted, the next one first.
+	std::unordered_map<Key, Entries::iterator, Hash> m_index;
+
+	size_t m_capacity;
+	Eviction m_eviction;
+
+	size_t m_hits;
+	size_t m_misses;
+	size_t m_evictions;
+
+	static Key key_of(const double* arguments, size_t count);
+
+public:
+	Memo(size_t capacity, Eviction eviction);
+
+	/// Counts a hit or a miss.
+	bool find(const double* arguments, size_t count, double& result);
+	/// Evicts an entry if the table is full.
+	void insert(const double* arguments, size_t count, double result);
+
+	size_t hits() const;
+	size_t misses() const;
+	size_t evictions() const;
+	size_t size() const;
+};
+
+/// Results shared by every process on the host through a memory mapped file: a hash table with a fixed number of slots.
+/// A slot is claimed, filled and then published, and never changes after that, so that reading needs no lock.
+/// When the slots near the place of a result are all taken, the result is not kept.
+class Memo_File
+{
+private:
+	struct Header
+	{
+		uint64_t m_magic;
+		uint64_t m_version;
+		uint64_t m_capacity; /// How many slots follow.
+		uint64_t m_padding[5]; /// The slots start on a cache line of their own.
+	};
+
+	struct Slot
+	{
+		std::atomic<uint64_t> m_key; /// EMPTY, BUSY while being written, or the hash of the rest once published.
+		uint64_t m_function;
+		uint64_t m_count;
+		double m_arguments[Memo::MAX_ARITY];
+		double m_result;
+	};
+
+	static const uint64_t MAGIC = 0x4F4D454D43465354; /// "TSFCMEMO"
+	static const uint64_t VERSION = 1;
+	static const uint64_t EMPTY = 0;
+	static const uint64_t BUSY = 1;
+	static const size_t MAX_PROBES = 16; /// How far from its place a result may end up.
+
+	void* m_memory;
+	size_t m_size;
+	Slot* m_slots;
+	size_t m_capacity;
+
+	std::atomic<size_t> m_hits; /// Atomic since the workers of a parallel batch share the file.
+	std::atomic<size_t> m_misses;
+
+	static uint64_t key_of(uint64_t function, const double* arguments, size_t count);
+	/// Whether the published slot holds the call.
+	static bool holds(const Slot& slot, uint64_t function, const double* arguments, size_t count);
+
+public:
+	static const size_t DEFAULT_CAPACITY = 1 << 18; /// 24 MB, though the pages of a new file only take room once written.
+
+	Memo_File();
+	Memo_File(const Memo_File& rhs) = delete;
+	Memo_File& operator=(const Memo_File& rhs) = delete;
+	~Memo_File();
+
+	/// Maps the file, creating it with DEFAULT_CAPACITY slots if it does not exist.
+	/// Returns false if it cannot or the file is not a memo file.
+	bool open(const std::string& path);
+	bool is_open() const;
+
+	/// function is the hash of the definitions the result depends on. Counts a hit or a miss.
+	bool find(uint64_t function, const double* arguments, size_t count, double& result);
+	void insert(uint64_t function, const double* arguments, size_t count, double result);
+
+	size_t hits() const;
+	size_t misses() const;
+};
\ No newline at end of file
@@ -0,0 +1,245 @@
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <string>
+
+//#################################################
+// NUMBERS
+//#################################################
+
+/// What the numbers of a session are. Picked once, before anything gets evaluated.
+enum class Numbers
+{
+	DOUBLE,
+	INT64, /// Exact integers. An overflow is an error instead of a rounded result. There are no lists in this mode.
+	FLOAT32, /// Every result gets rounded to single precision and lists keep floats, which the list kernels take twice as many of at a time.
+};
+
+/// The builtins on numbers kept as T. Each one returns the error to report, or nullptr.
+/// This one is for the floating point types: the builtin is computed in double and the result rounded to T,
+/// which is what the list kernels do as well, so that a number gives the same result on its own and in a list.
+template<class T>
+struct Arithmetic
+{
+	/// Whether the literal can be a T. It is rounded to the nearest one.
+	static bool from(const double literal, T& value)
+	{
+		value = (T)literal;
+		return true;
+	}
+
+	static const char* unary(const std::string& name, const T argument, T& result)
+	{
+		double x = argument;
+
+		result = (T)(name == "sqrt" ? std::sqrt(x) : name == "sin" ? std::sin(x) : std::cos(x));
+		return nullptr;
+	}
+
+	static const char* binary(const std::string& name, const T left, const T right, T& result)
+	{
+		double l = left;
+		double r = right;
+
+		if (name == "div" && r == 0)
+		{
+			return "Division by 0";
+		}
+
+		result = (T)(name == "add" ? l + r
+			: name == "sub" ? l - r
+			: name == "mul" ? l * r
+			: name == "div" ? l / r
+			: name == "pow" ? std::pow(l, r)
+			: name == "eq" ? l == r
+			: name == "le" ? l < r
+			: !l || !r); // The only one left is nand.
+		return nullptr;
+	}
+};
+
+/// Exact 64 bit integers. div rounds towards 0 and sqrt down.
+template<>
+struct Arithmetic<int64_t>
+{
+	static bool from(const double literal, int64_t& value)
+	{
+		// 2^63 itself is already too big.
+		if (literal != std::floor(literal) || literal < -9223372036854775808.0 || literal >= 9223372036854775808.0)
+		{
+			return false;
+		}
+
+		value = (int64_t)literal;
+		return true;
+	}
+
+	static const char* unary(const std::string& name, const int64_t argument, int64_t& result)
+	{
+		if (name != "sqrt")
+		{
+			return "sin and cos need floating point numbers";
+		}
+
+		if (argument < 0)
+		{
+			return "Square root of a negative number";
+		}
+
+		// The double is off by at most one either way, which the loops correct.
+		result = (int64_t)std::sqrt((double)argument);
+
+		while (result > 0 && result > argument / result)
+		{
+			--result;
+		}
+
+		while (result + 1 <= argument / (result + 1))
+		{
+			++result;
+		}
+
+		return nullptr;
+	}
+
+	static const char* binary(const std::string& name, const int64_t left, const int64_t right, int64_t& result)
+	{
+		if (name == "add")
+		{
+			return add(left, right, result) ? nullptr : "Integer overflow";
+		}
+		if (name == "sub")
+		{
+			return subtract(left, right, result) ? nullptr : "Integer overflow";
+		}
+		if (name == "mul")
+		{
+			return multiply(left, right, result) ? nullptr : "Integer overflow";
+		}
+		if (name == "div")
+		{
+			if (right == 0)
+			{
+				return "Division by 0";
+			}
+
+			if (left == std::numeric_limits<int64_t>::min() && right == -1)
+			{
+				return "Integer overflow";
+			}
+
+			result = left / right;
+			return nullptr;
+		}
+		if (name == "pow")
+		{
+			return power(left, right, result);
+		}
+
+		result = name == "eq" ? left == right
+			: name == "le" ? left < right
+			: !left || !right; // The only one left is nand.
+		return nullptr;
+	}
+
+	/// Exponentiation by squaring, which checks every product.
+	static const char* power(int64_t base, int64_t exponent, int64_t& result)
+	{
+		// Only 1 and -1 have integer powers with negative exponents.
+		if (exponent < 0)
+		{
+			if (base != 1 && base != -1)
+			{
+				return "Expected a non-negative exponent";
+			}
+
+			result = base == -1 && exponent % 2 != 0 ? -1 : 1;
+			return nullptr;
+		}
+
+		result = 1;
+
+		while (exponent > 0)
+		{
+			if (exponent % 2 != 0 && !multiply(result, base, result))
+			{
+				return "Integer overflow";
+			}
+
+			exponent /= 2;
+
+			// The last square is never needed, and it might overflow where the result does not.
+			if (exponent > 0 && !multiply(base, base, base))
+			{
+				return "Integer overflow";
+			}
+		}
+
+		return nullptr;
+	}
+
+#if defined(__GNUC__) || defined(__clang__)
+	static bool add(const int64_t left, const int64_t right, int64_t& result)
+	{
+		return !__builtin_add_overflow(left, right, &result);
+	}
+
+	static bool subtract(const int64_t left, const int64_t right, int64_t& result)
+	{
+		return !__builtin_sub_overflow(left, right, &result);
+	}
+
+	static bool multiply(const int64_t left, const int64_t right, int64_t& result)
+	{
+		return !__builtin_mul_overflow(left, right, &result);
+	}
+#else
+	static bool add(const int64_t left, const int64_t right, int64_t& result)
+	{
+		if (right > 0 ? left > std::numeric_limits<int64_t>::max() - right : left < std::numeric_limits<int64_t>::min() - right)
+		{
+			return false;
+		}
+
+		result = left + right;
+		return true;
+	}
+
+	static bool subtract(const int64_t left, const int64_t right, int64_t& result)
+	{
+		if (right < 0 ? left > std::numeric_limits<int64_t>::max() + right : left < std::numeric_limits<int64_t>::min() + right)
+		{
+			return false;
+		}
+
+		result = left - right;
+		return true;
+	}
+
+	static bool multiply(const int64_t left, const int64_t right, int64_t& result)
+	{
+		if (left != 0 && right != 0)
+		{
+			if ((left == -1 && right == std::numeric_limits<int64_t>::min()) || (right == -1 && left == std::numeric_limits<int64_t>::min()))
+			{
+				return false;
+			}
+
+			if (left != -1 && right != -1)
+			{
+				int64_t product = (int64_t)((uint64_t)left * (uint64_t)right);
+
+				if (product / right != left)
+				{
+					return false;
+				}
+			}
+		}
+
+		result = (int64_t)((uint64_t)left * (uint64_t)right);
+		return true;
+	}
+#endif
+};
\ No newline at end of file
@@ -27,7 +27,15 @@ void Node::copy(const Node& rhs)
 
 	if (n_ptr)
 	{
-		m_token = new Number_Token(n_ptr->m_value);
+		m_token = new Number_Token(*n_ptr);
+		return;
+	}
+
+	const Text_Token* t_ptr = dynamic_cast<const Text_Token*>(rhs.m_token);
+
+	if (t_ptr)
+	{
+		m_token = new Text_Token(t_ptr->m_text);
 		return;
 	}
 
@@ -63,7 +71,15 @@ Node::Node(const Token* token)
 
 	if (n_ptr)
 	{
-		m_token = new Number_Token(n_ptr->m_value);
+		m_token = new Number_Token(*n_ptr);
+		return;
+	}
+
+	const Text_Token* t_ptr = dynamic_cast<const Text_Token*>(token);
+
+	if (t_ptr)
+	{
+		m_token = new Text_Token(t_ptr->m_text);
 		return;
 	}
 
@@ -356,6 +372,9 @@ Map_Operation_Node::~Map_Operation_Node()
 {
 	delete m_functor;
 	m_functor = nullptr;
+
+	delete m_list;
+	m_list = nullptr;
 }
 
 void Map_Operation_Node::print(std::ostream& out) const
@@ -374,6 +393,99 @@ void Map_Operation_Node::print(std::ostream& out) const
 	out << ')';
 }
 
+Reduce_Operation_Node::Reduce_Operation_Node(const Token* token, const Node* functor, const Node* initial, const Node* list)
+	: Node(token),
+	m_functor(functor),
+	m_initial(initial),
+	m_list(list)
+{ }
+
+Reduce_Operation_Node::~Reduce_Operation_Node()
+{
+	delete m_functor;
+	m_functor = nullptr;
+
+	delete m_initial;
+	m_initial = nullptr;
+
+	delete m_list;
+	m_list = nullptr;
+}
+
+void Reduce_Operation_Node::print(std::ostream& out) const
+{
+	out << '(';
+	Node::print(out);
+	out << ' ';
+	m_functor->print(out);
+	out << ' ';
+	if (m_initial)
+	{
+		m_initial->print(out);
+		out << ' ';
+	}
+	m_list->print(out);
+	out << ')';
+}
+
+Filter_Operation_Node::Filter_Operation_Node(const Token* token, const Node* functor, const Node* list)
+	: Node(token),
+	m_functor(functor),
+	m_list(list)
+{ }
+
+Filter_Operation_Node::~Filter_Operation_Node()
+{
+	delete m_functor;
+	m_functor = nullptr;
+
+	delete m_list;
+	m_list = nullptr;
+}
+
+void Filter_Operation_Node::print(std::ostream& out) const
+{
+	out << '(';
+	Node::print(out);
+	out << ' ';
+	m_functor->print(out);
+	out << ' ';
+	m_list->print(out);
+	out << ')';
+}
+
+Zip_Operation_Node::Zip_Operation_Node(const Token* token, const Node* functor, const Node* left, const Node* right)
+	: Node(token),
+	m_functor(functor),
+	m_left(left),
+	m_right(right)
+{ }
+
+Zip_Operation_Node::~Zip_Operation_Node()
+{
+	delete m_functor;
+	m_functor = nullptr;
+
+	delete m_left;
+	m_left = nullptr;
+
+	delete m_right;
+	m_right = nullptr;
+}
+
+void Zip_Operation_Node::print(std::ostream& out) const
+{
+	out << '(';
+	Node::print(out);
+	out << ' ';
+	m_functor->print(out);
+	out << ' ';
+	m_left->print(out);
+	out << ' ';
+	m_right->print(out);
+	out << ')';
+}
+
 void User_Function::copy(const User_Function& rhs)
 {
 	m_definition = rhs.m_definition->clone();
@@ -396,11 +508,19 @@ void User_Function::del()
 User_Function::User_Function(const Token* token, const Node* definition, const std::vector<const Node*>& arguments)
 	: Node(token),
 	m_definition(definition),
-	m_arguments(arguments)
+	m_arguments(arguments),
+	m_calls(0),
+	m_recursive_calls(0),
+	m_tier(Tier::INTERPRETED),
+	m_native(nullptr)
 { }
 
 User_Function::User_Function(const User_Function & rhs)
-	: Node(rhs.m_token)
+	: Node(rhs.m_token),
+	m_calls(0),
+	m_recursive_calls(0),
+	m_tier(Tier::INTERPRETED),
+	m_native(nullptr)
 {
 	copy(rhs);
 }
@@ -458,7 +578,7 @@ User_Function* User_Function::clone() const
 
 void Parser::advance()
 {
-	if (m_current_index + 1 < m_tokens.size())
+	if ((size_t)m_current_index + 1 < m_tokens.size())
 	{
 		++m_current_index;
 		m_current_type = m_tokens[m_current_index]->m_type;
@@ -469,6 +589,59 @@ void Parser::advance()
 	}
 }
 
+void Parser::retreat()
+{
+	if (m_current_index == -1)
+	{
+		m_current_index = m_tokens.size();
+	}
+
+	--m_current_index;
+	m_current_type = m_tokens[m_current_index]->m_type;
+}
+
+void Parser::finish(const Node* node)
+{
+	if (!dynamic_cast<const Factor_Node*>(node) && !dynamic_cast<const Argument_Node*>(node))
+	{
+		advance();
+	}
+}
+
+bool Parser::operands(std::vector<Node*>& nodes, size_t count, std::ostream& out)
+{
+	// The operands have to be parsed in this order (the order of the arguments of a call is not defined).
+	for (size_t i = 0; i < count; ++i)
+	{
+		if (m_current_index == -1 || m_current_type != (i == 0 ? Type::OPENING_BRACKET : Type::COMMA))
+		{
+			Illegal_Syntax(i == 0 ? "Expected '('" : "Expected ','").print(out);
+		}
+		else
+		{
+			advance();
+
+			Node* n = m_current_index != -1 ? expr(out) : nullptr;
+
+			if (n)
+			{
+				nodes.push_back(n);
+				finish(n);
+				continue;
+			}
+		}
+
+		for (Node* a : nodes)
+		{
+			delete a;
+		}
+
+		return false;
+	}
+
+	return true;
+}
+
 Node* Parser::factor(std::ostream& out)
 {
 	if (m_current_index != -1)
@@ -484,7 +657,14 @@ Node* Parser::factor(std::ostream& out)
 
 Node* Parser::expr(std::ostream& out)
 {
-	if (m_current_type != Type::NUMBER)
+	if (m_current_type == Type::ARGUMENT)
+	{
+		Argument_Node* n = new Argument_Node(m_tokens[m_current_index]);
+		advance();
+		return n;
+	}
+
+	if (m_current_type != Type::NUMBER && m_current_type != Type::TEXT)
 	{
 		if (m_current_type != Type::FUNCTION_NAME)
 		{
@@ -517,53 +697,68 @@ Node* Parser::expr(std::ostream& out)
 
 			std::vector<Node*> arguments;
 
-			do
+			while (m_current_index != -1 && m_current_type != Type::CLOSING_BRACKET)
 			{
-				if (m_current_index == -1)
+				Node* n = expr(out);
+
+				if (!n)
 				{
-					Illegal_Syntax("Unexpected end of input").print(out);
 					return nullptr;
 				}
-				else if (m_current_type == Type::COMMA)
+
+				arguments.push_back(n);
+				finish(n);
+
+				if (m_current_index != -1 && m_current_type == Type::COMMA)
 				{
 					advance();
 				}
+			}
 
-				arguments.push_back(expr(out));
+			if (m_current_index == -1)
+			{
+				Illegal_Syntax("Unexpected end of input").print(out);
+				return nullptr;
+			}
 
-				size_t size = m_tokens.size();
+			return new List_Operation_Node(operation, arguments);
+		}
+		else if (f_ptr && (f_ptr->m_name == "map" || f_ptr->m_name == "filter" || f_ptr->m_name == "reduce"))
+		{
+			std::vector<Node*> nodes;
 
-				if (m_current_type == Type::CLOSING_BRACKET && (m_current_index + 1 >= size || m_tokens[m_current_index + 1]->m_type == Type::CLOSING_BRACKET || m_current_index + 2 >= size || m_tokens[m_current_index + 2]->m_type == Type::FUNCTION_NAME))
-				{
-					if (m_current_index + 1 < size && m_tokens[m_current_index + 1]->m_type == Type::CLOSING_BRACKET)
-					{
-						advance();
-					}
-					break;
-				}
+			if (!operands(nodes, 2, out))
+			{
+				return nullptr;
+			}
 
-				advance();
+			if (f_ptr->m_name == "map")
+			{
+				return new Map_Operation_Node(operation, nodes[0], nodes[1]);
+			}
 
-				if (m_current_index != -1 && m_current_type == Type::CLOSING_BRACKET)
-				{
-					advance();
-					if (m_current_index == -1)
-					{
-						break;
-					}
-					else if (m_current_type == Type::COMMA)
-					{
-						advance();
-					}
-				}
-			} while (m_current_index != -1 && (m_current_type == Type::FUNCTION_NAME || m_current_type == Type::COMMA || m_current_type == Type::NUMBER));
+			if (f_ptr->m_name == "filter")
+			{
+				return new Filter_Operation_Node(operation, nodes[0], nodes[1]);
+			}
 
-			return new List_Operation_Node(operation, arguments);
+			return new Reduce_Operation_Node(operation, nodes[0], nullptr, nodes[1]);
 		}
-		else if (f_ptr && f_ptr->m_name == "map")
+		else if (f_ptr && (f_ptr->m_name == "foldl" || f_ptr->m_name == "zipWith"))
 		{
-			advance();
-			return new Map_Operation_Node(operation, expr(out), expr(out));
+			std::vector<Node*> nodes;
+
+			if (!operands(nodes, 3, out))
+			{
+				return nullptr;
+			}
+
+			if (f_ptr->m_name == "foldl")
+			{
+				return new Reduce_Operation_Node(operation, nodes[0], nodes[1], nodes[2]);
+			}
+
+			return new Zip_Operation_Node(operation, nodes[0], nodes[1], nodes[2]);
 		}
 
 		if (m_current_index == -1 || m_current_type != Type::OPENING_BRACKET)
@@ -576,7 +771,8 @@ Node* Parser::expr(std::ostream& out)
 
 			if (m_current_type == Type::COMMA || m_current_type == Type::CLOSING_BRACKET)
 			{
-				advance();
+				// Stay on the name, the way a call stays on its closing bracket.
+				retreat();
 				return new User_Function(operation, nullptr, {});
 			}
 
@@ -610,6 +806,7 @@ Node* Parser::expr(std::ostream& out)
 			break;
 		}
 		case Type::NUMBER:
+		case Type::TEXT:
 		{
 			left = factor(out);
 			break;
@@ -679,25 +876,37 @@ Node* Parser::expr(std::ostream& out)
 				if (f_ptr && f_ptr->m_name == "if")
 				{
 					advance();
-					return new If_Opeation_Node(f_ptr, left, right, expr(out));
+
+					Node* third = expr(out);
+
+					if (third)
+					{
+						finish(third);
+					}
+
+					return new If_Opeation_Node(f_ptr, left, right, third);
 				}
 				else
 				{
-					advance();
 					std::vector<const Node*> m_arguments;
 					m_arguments.push_back(left);
 					m_arguments.push_back(right);
-					Node* n = expr(out);
-					while (n)
+
+					while (m_current_index != -1 && m_current_type == Type::COMMA)
 					{
-						m_arguments.push_back(n);
 						advance();
-						if (m_current_type == Type::COMMA)
+
+						Node* n = expr(out);
+
+						if (!n)
 						{
-							advance();
+							break;
 						}
-						n = expr(out);
+
+						m_arguments.push_back(n);
+						finish(n);
 					}
+
 					return new User_Function(operation, nullptr, m_arguments);
 				}
 			}
@@ -737,5 +946,32 @@ Node* Parser::parse(std::ostream& out)
 		return nullptr;
 	}
 
+	// The parser and every walk over the tree after it go a call deeper per level, so deeper lines are refused here
+	// rather than run out of stack. A level is an open bracket or a definition that the rest of the line is the body of.
+	size_t depth = 0;
+	size_t definitions = 0;
+
+	for (const Token* a : m_tokens)
+	{
+		if (a->m_type == Type::OPENING_BRACKET)
+		{
+			++depth;
+		}
+		else if (a->m_type == Type::CLOSING_BRACKET && depth > 0)
+		{
+			--depth;
+		}
+		else if (a->m_type == Type::ARROW)
+		{
+			++definitions;
+		}
+
+		if (depth + definitions > MAX_DEPTH)
+		{
+			Illegal_Syntax("Too deeply nested").print(out);
+			return nullptr;
+		}
+	}
+
 	return expr(out);
 }
\ No newline at end of file
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <atomic>
 #include "Lexer.h"
 
 //#################################################
@@ -113,11 +114,68 @@ struct Map_Operation_Node :public Node
 	void print(std::ostream& out) const override;
 };
 
+/// reduce(f, l) folds the list with the function from the left, starting with its first element. foldl(f, initial, l) starts with initial.
+struct Reduce_Operation_Node :public Node
+{
+	const Node* m_functor;
+	const Node* m_initial; /// nullptr for reduce.
+	const Node* m_list;
+
+	Reduce_Operation_Node(const Token* token, const Node* functor, const Node* initial, const Node* list);
+	~Reduce_Operation_Node();
+
+	void print(std::ostream& out) const override;
+};
+
+/// filter(p, l) keeps the elements for which p is not 0.
+struct Filter_Operation_Node :public Node
+{
+	const Node* m_functor;
+	const Node* m_list;
+
+	Filter_Operation_Node(const Token* token, const Node* functor, const Node* list);
+	~Filter_Operation_Node();
+
+	void print(std::ostream& out) const override;
+};
+
+/// zipWith(f, l1, l2) calls the function with the elements of both lists at the same index, up to the end of the shorter one.
+struct Zip_Operation_Node :public Node
+{
+	const Node* m_functor;
+	const Node* m_left;
+	const Node* m_right;
+
+	Zip_Operation_Node(const Token* token, const Node* functor, const Node* left, const Node* right);
+	~Zip_Operation_Node();
+
+	void print(std::ostream& out) const override;
+};
+
+struct Jit_Function;
+
+/// How far a user function has been optimized. The interpreter moves it up once it gets called enough.
+enum class Tier
+{
+	INTERPRETED,
+	QUEUED, /// Waiting for the background compiler.
+	COMPILED, /// m_native is set.
+	UNSUPPORTED, /// Uses something that the compiler does not support (so far).
+	MEMOIZED, /// Stays interpreted so that every call goes through its memo table.
+};
+
 struct User_Function :public Node
 {
 	const Node* m_definition;
 	std::vector<const Node*> m_arguments;
 
+	/// The profile that decides when the function is worth compiling. Neither is copied.
+	mutable std::atomic<size_t> m_calls;
+	mutable std::atomic<size_t> m_recursive_calls; /// The calls made from its own definition, i.e. the back-edges.
+
+	mutable std::atomic<Tier> m_tier;
+	mutable std::atomic<const Jit_Function*> m_native;
+
 	void copy(const User_Function& rhs);
 	void del();
 
@@ -138,6 +196,9 @@ struct User_Function :public Node
 class Parser
 {
 private:
+	/// How deep a line may nest (brackets and definitions together). Deeper ones are a syntax error.
+	static const size_t MAX_DEPTH = 1024;
+
 	/// Unlike the lexer, store the vector.
 	std::vector<Token*> m_tokens;
 
@@ -147,6 +208,15 @@ private:
 
 	/// Increment the index and get if it is less than the size of the vector get the type.
 	void advance();
+	/// Go back to the previous token.
+	void retreat();
+	/// An expression ends on its last token (the closing bracket of a call, the name of a function without arguments),
+	/// except for numbers and arguments which end right after it. Moves past the end of the node in every case.
+	void finish(const Node* node);
+
+	/// Parses the operands of map and the like: count expressions separated by commas, from the opening bracket on.
+	/// Stops on the closing bracket. Returns false (and deletes what it parsed) if any of them is missing.
+	bool operands(std::vector<Node*>& nodes, size_t count, std::ostream& out);
 
 	/// Returns a factor node if the index is valid and nullptr otherwise.
 	Node* factor(std::ostream& out);
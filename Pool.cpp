@@ -0,0 +1,169 @@
+#include "Pool.h"
+
+Pool::Pool()
+	: m_size(std::thread::hardware_concurrency() > 0 ? std::thread::hardware_concurrency() : 1),
+	m_task(nullptr),
+	m_remaining(0),
+	m_generation(0),
+	m_stopping(false)
+{ }
+
+Pool::~Pool()
+{
+	stop();
+}
+
+size_t Pool::size() const
+{
+	return m_size;
+}
+
+void Pool::set_size(size_t threads)
+{
+	stop();
+
+	m_size = threads > 0 ? threads : 1;
+	m_queues.clear();
+	m_stopping = false;
+}
+
+void Pool::run(size_t count, const std::function<void(size_t)>& task)
+{
+	if (m_size == 1 || count < 2)
+	{
+		for (size_t i = 0; i < count; ++i)
+		{
+			task(i);
+		}
+		return;
+	}
+
+	if (m_workers.empty())
+	{
+		while (m_queues.size() < m_size)
+		{
+			m_queues.emplace_back();
+		}
+
+		for (size_t i = 1; i < m_size; ++i)
+		{
+			m_workers.emplace_back(&Pool::work, this, i);
+		}
+	}
+
+	// The task has to be in place before any worker can find something in the queues.
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_task = &task;
+		m_remaining = count;
+	}
+
+	// Every thread starts with a contiguous range, so neighbouring tasks mostly run on the same thread.
+	for (size_t i = 0; i < m_size; ++i)
+	{
+		std::lock_guard<std::mutex> lock(m_queues[i].m_mutex);
+
+		for (size_t j = count * i / m_size; j < count * (i + 1) / m_size; ++j)
+		{
+			m_queues[i].m_tasks.push_back(j);
+		}
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		++m_generation;
+	}
+
+	m_wake.notify_all();
+	drain(0);
+
+	std::unique_lock<std::mutex> lock(m_mutex);
+	m_done.wait(lock, [this] { return m_remaining == 0; });
+	m_task = nullptr;
+}
+
+void Pool::work(size_t self)
+{
+	size_t generation = 0;
+
+	while (true)
+	{
+		{
+			std::unique_lock<std::mutex> lock(m_mutex);
+			m_wake.wait(lock, [this, generation] { return m_stopping || m_generation != generation; });
+
+			if (m_stopping)
+			{
+				return;
+			}
+
+			generation = m_generation;
+		}
+
+		drain(self);
+	}
+}
+
+void Pool::drain(size_t self)
+{
+	size_t task;
+
+	while (take(self, task))
+	{
+		(*m_task)(task);
+
+		std::lock_guard<std::mutex> lock(m_mutex);
+
+		if (--m_remaining == 0)
+		{
+			m_done.notify_one();
+		}
+	}
+}
+
+bool Pool::take(size_t self, size_t& task)
+{
+	for (size_t i = 0; i < m_size; ++i)
+	{
+		Queue& queue = m_queues[(self + i) % m_size];
+		std::lock_guard<std::mutex> lock(queue.m_mutex);
+
+		if (queue.m_tasks.empty())
+		{
+			continue;
+		}
+
+		// The owner works from the front and the thieves from the back, so they seldom meet.
+		if (i == 0)
+		{
+			task = queue.m_tasks.front();
+			queue.m_tasks.pop_front();
+		}
+		else
+		{
+			task = queue.m_tasks.back();
+			queue.m_tasks.pop_back();
+		}
+
+		return true;
+	}
+
+	return false;
+}
+
+void Pool::stop()
+{
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_stopping = true;
+	}
+
+	m_wake.notify_all();
+
+	for (std::thread& a : m_workers)
+	{
+		a.join();
+	}
+
+	m_workers.clear();
+}
\ No newline at end of file
@@ -0,0 +1,92 @@
+#pragma once
+
+#include <algorithm>
+#include <deque>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+
+//#################################################
+// POOL
+//#################################################
+
+/// Threads that share the work of a loop. Every thread has its own queue of tasks and, once it runs out,
+/// steals from the others, so that tasks which take longer than the rest do not hold everybody up.
+class Pool
+{
+private:
+	struct Queue
+	{
+		std::mutex m_mutex;
+		std::deque<size_t> m_tasks;
+	};
+
+	size_t m_size; /// How many threads work on a loop, the calling one included.
+
+	std::deque<Queue> m_queues; /// A deque so that the mutexes never move. The first one belongs to the calling thread.
+	std::vector<std::thread> m_workers; /// Started by the first loop.
+
+	std::mutex m_mutex; /// Guards everything below.
+	std::condition_variable m_wake; /// The workers wait here for a loop.
+	std::condition_variable m_done; /// The calling thread waits here for the last task.
+	const std::function<void(size_t)>* m_task;
+	size_t m_remaining; /// The tasks of the loop that have not finished yet.
+	size_t m_generation; /// Counts the loops, so that a worker can tell a new one from the one it just did.
+	bool m_stopping;
+
+	/// The loop of a worker thread.
+	void work(size_t self);
+	/// Runs tasks, its own first and then those of the others, until there are none left.
+	void drain(size_t self);
+	/// Takes the next task of its own queue or steals the last one of another.
+	bool take(size_t self, size_t& task);
+	/// Joins the workers.
+	void stop();
+
+public:
+	/// As many threads as the processor has.
+	Pool();
+	Pool(const Pool& rhs) = delete;
+	Pool& operator=(const Pool& rhs) = delete;
+	~Pool();
+
+	size_t size() const;
+	/// Only between loops. 1 keeps everything on the calling thread.
+	void set_size(size_t threads);
+
+	/// Calls task(i) for every i from 0 to count, spread over the threads. Returns once all of them are done.
+	/// The tasks must not throw nor start a loop of their own.
+	void run(size_t count, const std::function<void(size_t)>& task);
+
+	/// Every thread sorts a part, then the parts get merged pairwise, the merges of a round side by side.
+	template<class I, class C>
+	void sort(I first, I last, C less)
+	{
+		size_t count = last - first;
+		std::vector<size_t> bounds(m_size + 1);
+
+		for (size_t i = 0; i <= m_size; ++i)
+		{
+			bounds[i] = count * i / m_size;
+		}
+
+		run(m_size, [first, &bounds, &less](size_t i)
+		{
+			std::sort(first + bounds[i], first + bounds[i + 1], less);
+		});
+
+		for (size_t width = 1; width < m_size; width *= 2)
+		{
+			run((m_size + 2 * width - 1) / (2 * width), [this, first, width, &bounds, &less](size_t i)
+			{
+				size_t begin = 2 * width * i;
+				size_t middle = begin + width < m_size ? begin + width : m_size;
+				size_t end = begin + 2 * width < m_size ? begin + 2 * width : m_size;
+
+				std::inplace_merge(first + bounds[begin], first + bounds[middle], first + bounds[end], less);
+			});
+		}
+	}
+};
\ No newline at end of file
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <utility>
+
 template <class T>
 class Stack
 {
@@ -14,6 +16,8 @@ private:
 
 public:
 	Stack();
+	/// Starts with room for capacity elements.
+	explicit Stack(size_t capacity);
 
 	Stack(const Stack& rhs) = delete;
 	Stack& operator=(const Stack& rhs) = delete;
@@ -31,6 +35,13 @@ public:
 	T top() const;
 
 	size_t size() const;
+
+	/// Counting from the bottom. Used to reach the arguments of a function call in place.
+	T& operator[](size_t index);
+	const T& operator[](size_t index) const;
+
+	/// Drops everything above the first size elements.
+	void truncate(size_t size);
 };
 
 template<class T>
@@ -38,9 +49,9 @@ inline void Stack<T>::resize()
 {
 	T* data = new T[m_capacity * 2];
 
-	for (size_t i = 0; i < m_tos; i++)
+	for (size_t i = 0; i < (size_t)m_tos; i++)
 	{
-		data[i] = m_data[i];
+		data[i] = std::move(m_data[i]);
 	}
 
 	m_capacity *= 2;
@@ -56,6 +67,13 @@ inline Stack<T>::Stack()
 	m_tos(0)
 { }
 
+template<class T>
+inline Stack<T>::Stack(size_t capacity)
+	: m_capacity(capacity > 0 ? capacity : 1),
+	m_data(new T[m_capacity]),
+	m_tos(0)
+{ }
+
 template<class T>
 inline Stack<T>::~Stack()
 {
@@ -65,7 +83,7 @@ inline Stack<T>::~Stack()
 template<class T>
 inline bool Stack<T>::is_full() const
 {
-	return m_tos == m_capacity;
+	return (size_t)m_tos == m_capacity;
 }
 
 template<class T>
@@ -88,7 +106,7 @@ inline void Stack<T>::push(const T& element)
 template<class T>
 inline T Stack<T>::pop()
 {
-	return m_data[--m_tos];
+	return std::move(m_data[--m_tos]); // Moving also lets go of whatever the element holds.
 }
 
 template<class T>
@@ -102,3 +120,24 @@ inline size_t Stack<T>::size() const
 {
 	return m_tos;
 }
+
+template<class T>
+inline T& Stack<T>::operator[](size_t index)
+{
+	return m_data[index];
+}
+
+template<class T>
+inline const T& Stack<T>::operator[](size_t index) const
+{
+	return m_data[index];
+}
+
+template<class T>
+inline void Stack<T>::truncate(size_t size)
+{
+	while ((size_t)m_tos > size)
+	{
+		pop();
+	}
+}
\ No newline at end of file
@@ -0,0 +1,142 @@
+#include "Trace.h"
+
+#include <cstring>
+#include <iterator>
+
+namespace
+{
+	/// Reads a varint from the characters at first, moving it past. Returns false if they end before it does.
+	bool read_varint(std::string::const_iterator& first, std::string::const_iterator last, uint64_t& value)
+	{
+		value = 0;
+
+		for (unsigned shift = 0; shift < 64; shift += 7)
+		{
+			if (first == last)
+			{
+				return false;
+			}
+
+			unsigned char byte = *first++;
+			value |= (uint64_t)(byte & 0x7F) << shift;
+
+			if (!(byte & 0x80))
+			{
+				return true;
+			}
+		}
+
+		return false;
+	}
+}
+
+Trace_Writer::Trace_Writer()
+	: m_last(0)
+{ }
+
+void Trace_Writer::write_varint(uint64_t value)
+{
+	while (value >= 0x80)
+	{
+		m_file.put((char)((value & 0x7F) | 0x80));
+		value >>= 7;
+	}
+
+	m_file.put((char)value);
+}
+
+bool Trace_Writer::open(const std::string& path)
+{
+	m_file.open(path, std::ios::binary | std::ios::trunc);
+
+	if (!m_file)
+	{
+		return false;
+	}
+
+	uint64_t magic = MAGIC;
+	uint32_t version = VERSION;
+
+	// The header is in the byte order of the host, which read_trace checks along with the magic number.
+	m_file.write((const char*)&magic, sizeof(magic));
+	m_file.write((const char*)&version, sizeof(version));
+	m_file.flush();
+
+	m_start = std::chrono::steady_clock::now();
+	m_last = 0;
+	return (bool)m_file;
+}
+
+bool Trace_Writer::is_open() const
+{
+	return m_file.is_open();
+}
+
+void Trace_Writer::record(const std::string& line)
+{
+	uint64_t now = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - m_start).count();
+
+	write_varint(now - m_last);
+	write_varint(line.size());
+	m_file.write(line.data(), line.size());
+	m_file.flush();
+
+	m_last = now;
+}
+
+bool read_trace(const std::string& path, std::vector<Trace_Entry>& entries, std::string& error)
+{
+	std::ifstream file(path, std::ios::binary);
+
+	if (!file)
+	{
+		error = "\"" + path + "\" cannot be opened";
+		return false;
+	}
+
+	std::string data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+	uint64_t magic;
+	uint32_t version;
+
+	if (data.size() < sizeof(magic) + sizeof(version))
+	{
+		error = "\"" + path + "\" is not a trace";
+		return false;
+	}
+
+	memcpy(&magic, data.data(), sizeof(magic));
+	memcpy(&version, data.data() + sizeof(magic), sizeof(version));
+
+	if (magic != Trace_Writer::MAGIC)
+	{
+		error = "\"" + path + "\" is not a trace";
+		return false;
+	}
+
+	if (version != Trace_Writer::VERSION)
+	{
+		error = "\"" + path + "\" is a trace of version " + std::to_string(version) + " instead of " + std::to_string(Trace_Writer::VERSION);
+		return false;
+	}
+
+	std::string::const_iterator first = data.begin() + sizeof(magic) + sizeof(version);
+	uint64_t time = 0;
+
+	while (first != data.end())
+	{
+		uint64_t delay;
+		uint64_t length;
+
+		if (!read_varint(first, data.end(), delay) || !read_varint(first, data.end(), length) || length > (uint64_t)(data.end() - first))
+		{
+			error = "\"" + path + "\" is cut short";
+			return false;
+		}
+
+		time += delay;
+		entries.push_back({ time, std::string(first, first + length) });
+		first += length;
+	}
+
+	return true;
+}
\ No newline at end of file
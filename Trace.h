@@ -0,0 +1,51 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+//#################################################
+// TRACES
+//#################################################
+
+/// A line of a recorded session and when it was read.
+struct Trace_Entry
+{
+	uint64_t m_time; /// In microseconds since the session started.
+	std::string m_line;
+};
+
+/// Records the lines of a session, each with the time it was read, so that the session can be replayed later.
+/// The file starts with a magic number and the version of the format. Then every line is the microseconds since
+/// the line before it and its length, both as varints (7 bits a byte), followed by its characters,
+/// which makes a typical line take two or three bytes more than its text.
+class Trace_Writer
+{
+private:
+	std::ofstream m_file;
+	std::chrono::steady_clock::time_point m_start;
+	uint64_t m_last; /// When the last line was read, in microseconds since the start.
+
+	void write_varint(uint64_t value);
+
+public:
+	static const uint64_t MAGIC = 0x4341525443465354; /// "TSFCTRAC"
+	static const uint32_t VERSION = 1;
+
+	Trace_Writer();
+	Trace_Writer(const Trace_Writer& rhs) = delete;
+	Trace_Writer& operator=(const Trace_Writer& rhs) = delete;
+
+	/// Creates the file (replacing what was there) and starts the clock.
+	bool open(const std::string& path);
+	bool is_open() const;
+
+	/// Appends the line, timed now. Every line is flushed, so that a session which gets killed still leaves its trace.
+	void record(const std::string& line);
+};
+
+/// Reads a whole trace into memory, so that replaying it does not wait on the file.
+/// Returns false, with the reason in error, if the file is not a trace or is cut short.
+bool read_trace(const std::string& path, std::vector<Trace_Entry>& entries, std::string& error);
\ No newline at end of file
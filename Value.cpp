@@ -0,0 +1,438 @@
+#include "Value.h"
+#include "Writer.h"
+
+Shared_Value::Shared_Value()
+	: m_references(1)
+{ }
+
+void Shared_Value::retain()
+{
+	m_references.fetch_add(1, std::memory_order_relaxed);
+}
+
+void Shared_Value::release()
+{
+	if (m_references.fetch_sub(1, std::memory_order_acq_rel) == 1)
+	{
+		delete this;
+	}
+}
+
+List_Value::List_Value(std::vector<double>&& elements)
+	: m_elements(std::move(elements)),
+	m_data(m_elements.data()),
+	m_single(false),
+	m_left(nullptr),
+	m_right(nullptr),
+	m_offset(0),
+	m_size(m_elements.size()),
+	m_depth(0)
+{ }
+
+List_Value::List_Value(std::vector<float>&& elements)
+	: m_data(nullptr),
+	m_floats(std::move(elements)),
+	m_single(true),
+	m_left(nullptr),
+	m_right(nullptr),
+	m_offset(0),
+	m_size(m_floats.size()),
+	m_depth(0)
+{ }
+
+List_Value::List_Value(const double* data, const size_t size)
+	: m_data(data),
+	m_single(false),
+	m_left(nullptr),
+	m_right(nullptr),
+	m_offset(0),
+	m_size(size),
+	m_depth(0)
+{ }
+
+List_Value::List_Value(List_Value* left, List_Value* right)
+	: m_data(nullptr),
+	m_single(left->m_single && right->m_single),
+	m_left(left),
+	m_right(right),
+	m_offset(0),
+	m_size(left->m_size + right->m_size),
+	m_depth((left->m_depth > right->m_depth ? left->m_depth : right->m_depth) + 1)
+{ }
+
+List_Value::List_Value(List_Value* leaf, const size_t offset, const size_t size)
+	: m_data(nullptr),
+	m_single(leaf->m_single),
+	m_left(leaf),
+	m_right(nullptr),
+	m_offset(offset),
+	m_size(size),
+	m_depth(0)
+{
+	leaf->retain();
+}
+
+List_Value::~List_Value()
+{
+	if (m_left)
+	{
+		m_left->release();
+	}
+
+	if (m_right)
+	{
+		m_right->release();
+	}
+}
+
+List_Value* List_Value::join(List_Value* left, List_Value* right)
+{
+	if (left->m_size == 0)
+	{
+		left->release();
+		return right;
+	}
+
+	if (right->m_size == 0)
+	{
+		right->release();
+		return left;
+	}
+
+	if (left->m_size + right->m_size <= CHUNK_SIZE && left->m_single && right->m_single)
+	{
+		std::vector<float> elements;
+		elements.reserve(left->m_size + right->m_size);
+
+		auto append = [&elements](const float* chunk, size_t count)
+		{
+			elements.insert(elements.end(), chunk, chunk + count);
+			return true;
+		};
+
+		left->for_each_float_chunk(0, left->m_size, append);
+		right->for_each_float_chunk(0, right->m_size, append);
+
+		left->release();
+		right->release();
+		return new List_Value(std::move(elements));
+	}
+
+	if (left->m_size + right->m_size <= CHUNK_SIZE)
+	{
+		std::vector<double> elements;
+		elements.reserve(left->m_size + right->m_size);
+
+		auto append = [&elements](const double* chunk, size_t count)
+		{
+			elements.insert(elements.end(), chunk, chunk + count);
+			return true;
+		};
+
+		left->for_each_chunk(0, left->m_size, append);
+		right->for_each_chunk(0, right->m_size, append);
+
+		left->release();
+		right->release();
+		return new List_Value(std::move(elements));
+	}
+
+	// Appending a short list to a rope that ends with a short chunk makes one chunk out of the two.
+	if (left->m_right && left->m_right->m_size + right->m_size <= CHUNK_SIZE)
+	{
+		List_Value* first = left->m_left;
+		List_Value* last = left->m_right;
+
+		first->retain();
+		last->retain();
+		left->release();
+
+		return join(first, join(last, right));
+	}
+
+	List_Value* list = new List_Value(left, right);
+
+	return list->m_depth > MAX_DEPTH ? rebalance(list) : list;
+}
+
+List_Value* List_Value::slice(const size_t offset, const size_t size)
+{
+	if (offset == 0 && size == m_size)
+	{
+		retain();
+		return this;
+	}
+
+	if (size == 0)
+	{
+		return new List_Value(std::vector<double>());
+	}
+
+	if (!m_left)
+	{
+		return new List_Value(this, offset, size);
+	}
+
+	if (!m_right)
+	{
+		return new List_Value(m_left, m_offset + offset, size);
+	}
+
+	size_t left = m_left->m_size;
+
+	if (offset + size <= left)
+	{
+		return m_left->slice(offset, size);
+	}
+
+	if (offset >= left)
+	{
+		return m_right->slice(offset - left, size);
+	}
+
+	return join(m_left->slice(offset, left - offset), m_right->slice(0, offset + size - left));
+}
+
+namespace
+{
+	/// Gathers the leaves and slices of the rope from left to right, with a reference to each.
+	void collect(List_Value* list, std::vector<List_Value*>& pieces)
+	{
+		if (list->m_right)
+		{
+			collect(list->m_left, pieces);
+			collect(list->m_right, pieces);
+			return;
+		}
+
+		list->retain();
+		pieces.push_back(list);
+	}
+
+	List_Value* build(const std::vector<List_Value*>& pieces, size_t begin, size_t end)
+	{
+		if (end - begin == 1)
+		{
+			return pieces[begin];
+		}
+
+		size_t middle = begin + (end - begin) / 2;
+
+		return new List_Value(build(pieces, begin, middle), build(pieces, middle, end));
+	}
+}
+
+List_Value* List_Value::rebalance(List_Value* list)
+{
+	std::vector<List_Value*> pieces;
+
+	collect(list, pieces);
+	list->release();
+
+	return build(pieces, 0, pieces.size());
+}
+
+double List_Value::at(size_t index) const
+{
+	const List_Value* list = this;
+
+	while (list->m_right)
+	{
+		if (index < list->m_left->m_size)
+		{
+			list = list->m_left;
+		}
+		else
+		{
+			index -= list->m_left->m_size;
+			list = list->m_right;
+		}
+	}
+
+	if (list->m_left)
+	{
+		index += list->m_offset;
+		list = list->m_left;
+	}
+
+	return list->m_single ? list->m_floats[index] : list->m_data[index];
+}
+
+Sequence_Value::Sequence_Value(const double start, const double step, const size_t count, const std::vector<const User_Function*>& functions)
+	: m_start(start),
+	m_step(step),
+	m_count(count),
+	m_functions(functions)
+{ }
+
+Thunk_Value::Thunk_Value(const Node* node, const size_t base, const size_t arity, const User_Function* function)
+	: m_node(node),
+	m_base(base),
+	m_arity(arity),
+	m_function(function),
+	m_forced(false)
+{ }
+
+void Value::release()
+{
+	if (m_shared)
+	{
+		m_shared->release();
+	}
+
+	m_shared = nullptr;
+}
+
+Value::Value(std::vector<double>&& elements)
+	: m_number(0),
+	m_shared(new List_Value(std::move(elements)))
+{ }
+
+Value::Value(std::vector<float>&& elements)
+	: m_number(0),
+	m_shared(new List_Value(std::move(elements)))
+{ }
+
+Value::Value(List_Value* list)
+	: m_number(0),
+	m_shared(list)
+{ }
+
+Value::Value(Sequence_Value* sequence)
+	: m_number(0),
+	m_shared(sequence)
+{ }
+
+Value::Value(Thunk_Value* thunk)
+	: m_number(0),
+	m_shared(thunk)
+{ }
+
+Value::Value(const Value& rhs)
+	: m_number(rhs.m_number),
+	m_shared(rhs.m_shared)
+{
+	if (m_shared)
+	{
+		m_shared->retain();
+	}
+}
+
+Value& Value::operator=(const Value& rhs)
+{
+	if (this != &rhs)
+	{
+		if (rhs.m_shared)
+		{
+			rhs.m_shared->retain();
+		}
+
+		release();
+		m_number = rhs.m_number;
+		m_shared = rhs.m_shared;
+	}
+	return *this;
+}
+
+Value& Value::operator=(Value&& rhs) noexcept
+{
+	if (this != &rhs)
+	{
+		release();
+		m_number = rhs.m_number;
+		m_shared = rhs.m_shared;
+		rhs.m_shared = nullptr;
+	}
+	return *this;
+}
+
+bool Value::is_list() const
+{
+	return dynamic_cast<const List_Value*>(m_shared) != nullptr;
+}
+
+size_t Value::size() const
+{
+	return static_cast<const List_Value*>(m_shared)->m_size;
+}
+
+double Value::at(size_t index) const
+{
+	return static_cast<const List_Value*>(m_shared)->at(index);
+}
+
+bool Value::is_single() const
+{
+	return static_cast<const List_Value*>(m_shared)->m_single;
+}
+
+std::vector<double> Value::elements() const
+{
+	std::vector<double> elements;
+	elements.reserve(size());
+
+	for_each_chunk([&elements](const double* chunk, size_t count)
+	{
+		elements.insert(elements.end(), chunk, chunk + count);
+		return true;
+	});
+
+	return elements;
+}
+
+Value Value::concat(const Value& left, const Value& right)
+{
+	List_Value* l = static_cast<List_Value*>(left.m_shared);
+	List_Value* r = static_cast<List_Value*>(right.m_shared);
+
+	l->retain();
+	r->retain();
+
+	return Value(List_Value::join(l, r));
+}
+
+Value Value::slice(const Value& list, const size_t offset, const size_t size)
+{
+	return Value(static_cast<List_Value*>(list.m_shared)->slice(offset, size));
+}
+
+const Sequence_Value* Value::sequence() const
+{
+	return dynamic_cast<const Sequence_Value*>(m_shared);
+}
+
+Thunk_Value* Value::thunk() const
+{
+	return dynamic_cast<Thunk_Value*>(m_shared);
+}
+
+void Value::print(Writer& out) const
+{
+	if (!m_shared)
+	{
+		out.write(m_number);
+		return;
+	}
+
+	bool first = true;
+
+	out.write('[');
+
+	for_each_chunk([&out, &first](const double* elements, size_t count)
+	{
+		for (size_t i = 0; i < count; ++i)
+		{
+			if (!first)
+			{
+				out.write(", ");
+			}
+
+			out.write(elements[i]);
+			first = false;
+		}
+
+		return true;
+	});
+
+	out.write(']');
+}
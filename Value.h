@@ -0,0 +1,306 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <vector>
+#include <ostream>
+
+//#################################################
+// VALUES
+//#################################################
+
+/// What lists and sequences have in common: they are shared by all the values that refer to them and never changed once made
+/// (apart from a thunk, which keeps its value once forced).
+struct Shared_Value
+{
+	std::atomic<size_t> m_references;
+
+	Shared_Value();
+	virtual ~Shared_Value() = default;
+
+	void retain();
+	/// Deletes the value once nobody refers to it anymore.
+	void release();
+};
+
+/// The elements of a list as a rope, so that joining and cutting lists never copies more than a chunk:
+/// a leaf packs its elements in one buffer, a slice views a part of a leaf and a concat refers to its two parts.
+/// The leaves of --numbers float32 keep floats, which take half the memory and fill twice as many SIMD lanes.
+struct List_Value :public Shared_Value
+{
+	static const size_t CHUNK_SIZE = 256; /// Lists shorter than this get copied into one leaf when joined, so the chunks stay big.
+	static const size_t MAX_DEPTH = 64; /// Deeper ropes get rebalanced.
+
+	std::vector<double> m_elements; /// Only in a leaf that owns its elements.
+	const double* m_data; /// The elements of a leaf: those of m_elements, or ones kept by a subclass (e.g. a mapped file). nullptr otherwise.
+	std::vector<float> m_floats; /// The elements of a leaf of floats, in place of m_data.
+	bool m_single; /// Whether every element is kept as a float: in a leaf of floats, a slice of one, or a concat of two such parts.
+	List_Value* m_left; /// The first part of a concat or the leaf of a slice. nullptr in a leaf.
+	List_Value* m_right; /// The second part of a concat. nullptr otherwise.
+	size_t m_offset; /// Where a slice starts in its leaf.
+	size_t m_size;
+	size_t m_depth;
+
+	explicit List_Value(std::vector<double>&& elements);
+	explicit List_Value(std::vector<float>&& elements);
+	/// A leaf whose elements belong to someone else, who has to keep them for as long as the leaf lives.
+	List_Value(const double* data, const size_t size);
+	/// Takes over a reference to each of the parts.
+	List_Value(List_Value* left, List_Value* right);
+	/// A view of size elements of the leaf, from offset on.
+	List_Value(List_Value* leaf, const size_t offset, const size_t size);
+	~List_Value();
+
+	/// Joins the lists. Takes over a reference to each of them and returns a new one.
+	static List_Value* join(List_Value* left, List_Value* right);
+	/// The elements from offset to offset + size. Returns a new reference.
+	List_Value* slice(const size_t offset, const size_t size);
+	/// Rebuilds the rope as a balanced tree. Takes over the reference.
+	static List_Value* rebalance(List_Value* list);
+
+	double at(size_t index) const;
+
+	/// Calls visit(elements, count) with every packed run of the elements from offset to offset + size, in order.
+	/// Floats get widened a piece at a time, so the elements passed to visit are only valid until it returns.
+	/// Stops as soon as visit returns false.
+	template<class F>
+	bool for_each_chunk(size_t offset, size_t size, F& visit) const
+	{
+		if (!m_left)
+		{
+			return m_single ? widen(m_floats.data() + offset, size, visit) : visit(m_data + offset, size);
+		}
+
+		if (!m_right)
+		{
+			return m_left->m_single ? widen(m_left->m_floats.data() + m_offset + offset, size, visit) : visit(m_left->m_data + m_offset + offset, size);
+		}
+
+		size_t left = m_left->m_size;
+
+		if (offset < left)
+		{
+			size_t count = size < left - offset ? size : left - offset;
+
+			if (!m_left->for_each_chunk(offset, count, visit))
+			{
+				return false;
+			}
+
+			offset += count;
+			size -= count;
+		}
+
+		return size == 0 || m_right->for_each_chunk(offset - left, size, visit);
+	}
+
+	/// The same with the floats as they are kept. Only valid if the list is single.
+	template<class F>
+	bool for_each_float_chunk(size_t offset, size_t size, F& visit) const
+	{
+		if (!m_left)
+		{
+			return visit(m_floats.data() + offset, size);
+		}
+
+		if (!m_right)
+		{
+			return visit(m_left->m_floats.data() + m_offset + offset, size);
+		}
+
+		size_t left = m_left->m_size;
+
+		if (offset < left)
+		{
+			size_t count = size < left - offset ? size : left - offset;
+
+			if (!m_left->for_each_float_chunk(offset, count, visit))
+			{
+				return false;
+			}
+
+			offset += count;
+			size -= count;
+		}
+
+		return size == 0 || m_right->for_each_float_chunk(offset - left, size, visit);
+	}
+
+private:
+	/// Calls visit with the floats as doubles, CHUNK_SIZE of them at a time.
+	template<class F>
+	static bool widen(const float* elements, size_t size, F& visit)
+	{
+		double buffer[CHUNK_SIZE];
+
+		for (size_t i = 0; i < size; i += CHUNK_SIZE)
+		{
+			size_t count = size - i < CHUNK_SIZE ? size - i : CHUNK_SIZE;
+
+			std::copy(elements + i, elements + i + count, buffer);
+
+			if (!visit(buffer, count))
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+};
+
+struct Node;
+class Writer;
+struct User_Function;
+struct Thunk_Value;
+
+/// A list whose elements are only computed when someone asks for them: start, start + step, start + 2 * step, ...
+/// with the functions that were mapped over it applied to every element, in order.
+struct Sequence_Value :public Shared_Value
+{
+	static const size_t ENDLESS = (size_t)-1;
+
+	double m_start;
+	double m_step;
+	size_t m_count; /// ENDLESS if the sequence never ends.
+	std::vector<const User_Function*> m_functions;
+
+	Sequence_Value(const double start, const double step, const size_t count, const std::vector<const User_Function*>& functions);
+};
+
+/// What the interpreter computes and keeps on its stack: a number, a list or a sequence.
+/// Copying a list or a sequence only copies the reference, so they can be passed around (e.g. as arguments) for free.
+class Value
+{
+private:
+	union
+	{
+		double m_number;
+		int64_t m_integer; /// In place of the number when the session computes with integers (see Numbers).
+	};
+	Shared_Value* m_shared; /// nullptr if the value is a number.
+
+	void release();
+
+public:
+	/// The number 0.
+	Value();
+	/// Not explicit so that numbers can be pushed as they are.
+	Value(const double number);
+	/// An integer, kept in the bits of the number.
+	explicit Value(const int64_t integer);
+	/// Takes over the elements and makes a new list out of them.
+	explicit Value(std::vector<double>&& elements);
+	explicit Value(std::vector<float>&& elements);
+	/// Takes over a reference to the list.
+	explicit Value(List_Value* list);
+	/// Takes over a newly made sequence.
+	explicit Value(Sequence_Value* sequence);
+	/// Takes over a newly made thunk.
+	explicit Value(Thunk_Value* thunk);
+
+	Value(const Value& rhs);
+	Value(Value&& rhs) noexcept;
+	Value& operator=(const Value& rhs);
+	Value& operator=(Value&& rhs) noexcept;
+	~Value();
+
+	bool is_number() const;
+	bool is_list() const;
+
+	/// Only valid if the value is a number.
+	double number() const;
+	/// Only valid if the value is a number that was made as an integer.
+	int64_t integer() const;
+	/// Only valid if the value is a list.
+	size_t size() const;
+	double at(size_t index) const;
+	/// Only valid for lists. Whether the elements are kept as floats.
+	bool is_single() const;
+	/// Calls visit(elements, count) with the elements, a packed run at a time. Stops as soon as visit returns false.
+	template<class F>
+	bool for_each_chunk(F visit) const
+	{
+		return static_cast<const List_Value*>(m_shared)->for_each_chunk(0, size(), visit);
+	}
+	/// The same with the floats of a single list.
+	template<class F>
+	bool for_each_float_chunk(F visit) const
+	{
+		return static_cast<const List_Value*>(m_shared)->for_each_float_chunk(0, size(), visit);
+	}
+	/// A copy of the elements, packed. Only valid for lists.
+	std::vector<double> elements() const;
+	/// Both only valid for lists. Neither of them copies more than a chunk of elements.
+	static Value concat(const Value& left, const Value& right);
+	static Value slice(const Value& list, const size_t offset, const size_t size);
+	/// nullptr if the value is not a sequence.
+	const Sequence_Value* sequence() const;
+	/// nullptr if the value is not a thunk.
+	Thunk_Value* thunk() const;
+
+	/// Numbers as usual, lists as [1, 2, 3]. Sequences need the interpreter to compute their elements so they are not printed here.
+	void print(Writer& out) const;
+};
+
+/// An argument of a user function that is only evaluated once the function asks for it (in lazy mode).
+/// It gets evaluated in the frame of the caller, which always outlasts the frame of the callee where the thunk lives.
+struct Thunk_Value :public Shared_Value
+{
+	const Node* m_node;
+	size_t m_base; /// The frame of the caller.
+	size_t m_arity;
+	const User_Function* m_function; /// The caller.
+	bool m_forced;
+	Value m_value; /// Once forced. Never a thunk itself.
+
+	Thunk_Value(const Node* node, const size_t base, const size_t arity, const User_Function* function);
+};
+
+// The members below run for every push and pop so they are kept inline.
+
+inline Value::Value()
+	: m_number(0),
+	m_shared(nullptr)
+{ }
+
+inline Value::Value(const double number)
+	: m_number(number),
+	m_shared(nullptr)
+{ }
+
+inline Value::Value(const int64_t integer)
+	: m_integer(integer),
+	m_shared(nullptr)
+{ }
+
+inline Value::Value(Value&& rhs) noexcept
+	: m_number(rhs.m_number),
+	m_shared(rhs.m_shared)
+{
+	rhs.m_shared = nullptr;
+}
+
+inline Value::~Value()
+{
+	if (m_shared)
+	{
+		release();
+	}
+}
+
+inline bool Value::is_number() const
+{
+	return m_shared == nullptr;
+}
+
+inline double Value::number() const
+{
+	return m_number;
+}
+
+inline int64_t Value::integer() const
+{
+	return m_integer;
+}
@@ -0,0 +1,102 @@
+#include "Writer.h"
+
+#include <charconv>
+#include <cmath>
+#include <cstring>
+
+Writer::Writer()
+	: m_buffer(BUFFER_SIZE),
+	m_size(0),
+	m_out(nullptr),
+	m_single_precision(false)
+{ }
+
+Writer::~Writer()
+{
+	flush();
+}
+
+void Writer::open(std::ostream& out)
+{
+	if (m_out != &out)
+	{
+		flush();
+		m_out = &out;
+	}
+}
+
+char* Writer::reserve(size_t size)
+{
+	if (m_size + size > m_buffer.size())
+	{
+		flush();
+	}
+
+	return m_buffer.data() + m_size;
+}
+
+void Writer::set_single_precision(bool enabled)
+{
+	m_single_precision = enabled;
+}
+
+void Writer::write(const double number)
+{
+	// Every integer below 2^53 is exact as a double. 0 is left to to_chars, which keeps the sign of -0.
+	if (number != 0 && std::fabs(number) < 9007199254740992.0 && number == std::trunc(number))
+	{
+		write((int64_t)number);
+		return;
+	}
+
+	char* first = reserve(MAX_NUMBER_SIZE);
+
+	// Without a format to_chars picks the shortest of the fixed and the scientific notation that round trips.
+	if (m_single_precision)
+	{
+		m_size += std::to_chars(first, first + MAX_NUMBER_SIZE, (float)number).ptr - first;
+	}
+	else
+	{
+		m_size += std::to_chars(first, first + MAX_NUMBER_SIZE, number).ptr - first;
+	}
+}
+
+void Writer::write(const int64_t integer)
+{
+	char* first = reserve(MAX_NUMBER_SIZE);
+
+	m_size += std::to_chars(first, first + MAX_NUMBER_SIZE, integer).ptr - first;
+}
+
+void Writer::write(const char c)
+{
+	*reserve(1) = c;
+	++m_size;
+}
+
+void Writer::write(const char* text)
+{
+	size_t length = strlen(text);
+
+	// A text that does not fit in the buffer goes to the stream directly.
+	if (length > m_buffer.size())
+	{
+		flush();
+		m_out->write(text, length);
+		return;
+	}
+
+	memcpy(reserve(length), text, length);
+	m_size += length;
+}
+
+void Writer::flush()
+{
+	if (m_size > 0 && m_out)
+	{
+		m_out->write(m_buffer.data(), m_size);
+	}
+
+	m_size = 0;
+}
\ No newline at end of file
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <vector>
+
+//#################################################
+// WRITER
+//#################################################
+
+/// Formats the results into a buffer of its own and hands it to the stream a big chunk at a time,
+/// so that printing a long list costs about as much as copying its text.
+/// Numbers get the shortest text that reads back as the same double (1e-07, 0.30000000000000004, ...),
+/// except for integers below 2^53, which are always written out in full (100000 rather than 1e+05).
+class Writer
+{
+private:
+	std::vector<char> m_buffer; /// Allocated once and reused for every result.
+	size_t m_size; /// How much of it is taken.
+	std::ostream* m_out;
+	bool m_single_precision; /// The shortest text that reads back as the same float instead (0.3 rather than 0.30000001192092896).
+
+	/// Flushes if there is not room for size more characters.
+	char* reserve(size_t size);
+
+public:
+	static const size_t BUFFER_SIZE = 1 << 16;
+	static const size_t MAX_NUMBER_SIZE = 32; /// Enough for the longest double, -2.2250738585072014e-308.
+
+	Writer();
+	Writer(const Writer& rhs) = delete;
+	Writer& operator=(const Writer& rhs) = delete;
+	/// Flushes.
+	~Writer();
+
+	/// Where the chunks go from now on. What was written before is flushed to the previous stream.
+	void open(std::ostream& out);
+
+	/// For the results of --numbers float32, which are floats kept in doubles.
+	void set_single_precision(bool enabled);
+
+	void write(const double number);
+	void write(const int64_t integer);
+	void write(const char c);
+	void write(const char* text);
+
+	/// Hands what is in the buffer to the stream. Needed before anything else writes to the stream directly.
+	void flush();
+};
\ No newline at end of file
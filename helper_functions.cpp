@@ -2,10 +2,39 @@
 
 bool is_character(const char c)
 {
-	return c >= 'A' && c <= 'Z' || c >= 'a' && c <= 'z';
+	return (c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z');
 }
 
 bool is_digit(const char c)
 {
 	return c >= '0' && c <= '9';
 }
+
+bool is_unary_builtin(const std::string& name)
+{
+	return name == "sqrt" || name == "sin" || name == "cos";
+}
+
+bool is_binary_builtin(const std::string& name)
+{
+	return name == "add" || name == "sub" || name == "mul" || name == "div" || name == "pow"
+		|| name == "eq" || name == "le" || name == "nand";
+}
+
+bool is_associative_builtin(const std::string& name)
+{
+	return name == "add" || name == "mul";
+}
+
+bool is_list_builtin(const std::string& name)
+{
+	return name == "concat" || name == "range" || name == "from" || name == "take" || name == "drop"
+		|| name == "head" || name == "tail" || name == "length" || name == "sum" || name == "min" || name == "max"
+		|| name == "mean" || name == "sort" || name == "argsort" || name == "dot" || name == "norm" || name == "axpy" || name == "matvec"
+		|| is_file_builtin(name);
+}
+
+bool is_file_builtin(const std::string& name)
+{
+	return name == "load" || name == "csv" || name == "save" || name == "savecsv";
+}
\ No newline at end of file
@@ -1,7 +1,23 @@
 #pragma once
 
+#include <string>
+
 /// Really those needn't be functions but for clarity, I separated them.
 
 bool is_character(const char c);
 
-bool is_digit(const char c);
\ No newline at end of file
+bool is_digit(const char c);
+
+/// The predefined functions that take one/two numbers.
+bool is_unary_builtin(const std::string& name);
+
+bool is_binary_builtin(const std::string& name);
+
+/// The binary ones whose order of evaluation does not matter, so that folds over them can be split up.
+bool is_associative_builtin(const std::string& name);
+
+/// The predefined functions that take or make lists and sequences (and are therefore left to the interpreter).
+bool is_list_builtin(const std::string& name);
+
+/// The list builtins that read or write a file. Its name is their first operand, as text in quotes.
+bool is_file_builtin(const std::string& name);
\ No newline at end of file
@@ -1,9 +1,243 @@
 #include "Lexer.h"
+#include "Interpreter.h"
+#include "Trace.h"
 
-int main()
+#include <charconv>
+#include <cstring>
+#include <fstream>
+
+namespace
+{
+	/// Reads the value of an option that takes a count. False for anything but a whole nonnegative number that fits.
+	bool read_count(const char* text, size_t& count)
+	{
+		const char* last = text + strlen(text);
+		std::from_chars_result result = std::from_chars(text, last, count);
+
+		return result.ec == std::errc() && result.ptr == last;
+	}
+}
+
+/// thisfunc [--no-jit] [--tier-threshold calls] [--memo | --memo-all] [--memo-size entries] [--memo-eviction lru|fifo] [--memo-file path] [--memo-stats] [--lazy] [--explicit-stack] [--stack-limit entries] [--numbers double|int64|float32] [--fast-math] [--compensated-sum] [--threads count] [--parallel-threshold elements] [--load library.so]... [--image functions.img]... [--save-image functions.img] [--record trace] [--batch [script] [--parallel]]
+///                                                  Starts the interpreter, with the functions of the libraries and images defined.
+///                                                  --save-image writes the functions defined by the end of the run to an image.
+///                                                  --batch [script] runs the script (or the standard input) without prompts
+///                                                  and exits with 1 if any line failed. --parallel evaluates the expressions
+///                                                  between two definitions side by side over the threads.
+///                                                  --record writes every line read, with the time it was read, to a trace.
+/// thisfunc [options] --replay trace [--paced]      Runs the lines of a trace (as fast as possible, or at the pace they were
+///                                                  recorded) and prints the percentiles of how long they took.
+/// thisfunc --compile definitions.txt library.so    Builds a library with native code for the definitions (one per line).
+int main(int argc, char* argv[])
 {
+	Interpreter i;
+	bool memo_statistics = false;
+	bool batch = false;
+	bool parallel = false;
+	std::string script; // Read from the standard input if empty.
+	std::string image; // Where the functions get saved on exit, if anywhere.
+	Trace_Writer trace;
+	std::string replayed; // The trace to replay, if any.
+	bool paced = false;
+	size_t count = 0; // The value of the last option that takes a count.
+
+	for (int j = 1; j < argc; ++j)
+	{
+		std::string option = argv[j];
+
+		if (option == "--compile" && j + 2 < argc)
+		{
+			return compile_library(argv[j + 1], argv[j + 2], std::cout) ? 0 : 1;
+		}
+		else if (option == "--numbers" && j + 1 < argc && (std::string(argv[j + 1]) == "double" || std::string(argv[j + 1]) == "int64" || std::string(argv[j + 1]) == "float32"))
+		{
+			std::string numbers = argv[++j];
+
+			i.set_numbers(numbers == "int64" ? Numbers::INT64 : numbers == "float32" ? Numbers::FLOAT32 : Numbers::DOUBLE);
+		}
+		else if (option == "--fast-math")
+		{
+			i.set_accuracy(Accuracy::FAST);
+		}
+		else if (option == "--compensated-sum")
+		{
+			i.set_summation(Summation::COMPENSATED);
+		}
+		else if (option == "--threads" && j + 1 < argc && read_count(argv[j + 1], count))
+		{
+			i.set_threads(count);
+			++j;
+		}
+		else if (option == "--parallel-threshold" && j + 1 < argc && read_count(argv[j + 1], count))
+		{
+			i.set_parallel_threshold(count);
+			++j;
+		}
+		else if (option == "--load" && j + 1 < argc)
+		{
+			if (!i.load_library(argv[++j], std::cout))
+			{
+				return 1;
+			}
+		}
+		else if (option == "--image" && j + 1 < argc)
+		{
+			if (!i.load_image(argv[++j], std::cout))
+			{
+				return 1;
+			}
+		}
+		else if (option == "--save-image" && j + 1 < argc)
+		{
+			image = argv[++j];
+		}
+		else if (option == "--no-jit")
+		{
+			i.set_jit(false);
+		}
+		else if (option == "--tier-threshold" && j + 1 < argc && read_count(argv[j + 1], count))
+		{
+			i.set_tier_threshold(count);
+			++j;
+		}
+		else if (option == "--memo")
+		{
+			i.set_memoization(Memoization::RECURSIVE);
+		}
+		else if (option == "--memo-all")
+		{
+			i.set_memoization(Memoization::ALL);
+		}
+		else if (option == "--memo-size" && j + 1 < argc && read_count(argv[j + 1], count))
+		{
+			i.set_memo_size(count);
+			++j;
+		}
+		else if (option == "--memo-eviction" && j + 1 < argc && (std::string(argv[j + 1]) == "lru" || std::string(argv[j + 1]) == "fifo"))
+		{
+			i.set_eviction(std::string(argv[++j]) == "lru" ? Eviction::LRU : Eviction::FIFO);
+		}
+		else if (option == "--memo-file" && j + 1 < argc)
+		{
+			if (!i.open_memo_file(argv[++j], std::cout))
+			{
+				return 1;
+			}
+		}
+		else if (option == "--batch")
+		{
+			batch = true;
+
+			if (j + 1 < argc && std::string(argv[j + 1]).compare(0, 2, "--") != 0)
+			{
+				script = argv[++j];
+			}
+		}
+		else if (option == "--record" && j + 1 < argc)
+		{
+			if (!trace.open(argv[++j]))
+			{
+				Error("Trace error", "\"" + std::string(argv[j]) + "\" cannot be written").print(std::cout);
+				return 1;
+			}
+		}
+		else if (option == "--replay" && j + 1 < argc)
+		{
+			replayed = argv[++j];
+		}
+		else if (option == "--paced")
+		{
+			paced = true;
+		}
+		else if (option == "--parallel")
+		{
+			parallel = true;
+		}
+		else if (option == "--memo-stats")
+		{
+			memo_statistics = true;
+		}
+		else if (option == "--lazy")
+		{
+			i.set_lazy(true);
+		}
+		else if (option == "--explicit-stack")
+		{
+			i.set_explicit_stack(true);
+		}
+		else if (option == "--stack-limit" && j + 1 < argc && read_count(argv[j + 1], count))
+		{
+			i.set_explicit_stack(true);
+			i.set_stack_limit(count);
+			++j;
+		}
+		else
+		{
+			std::cout << "Usage: " << argv[0] << " [--no-jit] [--tier-threshold calls] [--memo | --memo-all] [--memo-size entries] [--memo-eviction lru|fifo] [--memo-file path] [--memo-stats] [--lazy] [--explicit-stack] [--stack-limit entries] [--numbers double|int64|float32] [--fast-math] [--compensated-sum] [--threads count] [--parallel-threshold elements] [--load library.so]... [--image functions.img]... [--save-image functions.img] [--record trace] [--batch [script] [--parallel]]\n"
+				<< "       " << argv[0] << " [options] --replay trace [--paced]\n"
+				<< "       " << argv[0] << " --compile definitions.txt library.so\n";
+			return 1;
+		}
+	}
+
+	if (!replayed.empty())
+	{
+		bool ok = replay(replayed, i, paced, std::cout);
+
+		if (memo_statistics)
+		{
+			i.print_memo_statistics(std::cout);
+		}
+
+		return ok ? 0 : 1;
+	}
+
+	if (batch)
+	{
+		// Nothing waits for the output, so neither stream needs to keep in step with C's.
+		std::ios::sync_with_stdio(false);
+		std::cin.tie(nullptr);
+
+		std::ifstream file;
+
+		if (!script.empty())
+		{
+			file.open(script);
+
+			if (!file)
+			{
+				Error("File error", "\"" + script + "\" cannot be opened").print(std::cout);
+				return 1;
+			}
+		}
+
+		bool ok = run_batch(script.empty() ? std::cin : file, std::cout, i, parallel, trace.is_open() ? &trace : nullptr);
+
+		if (memo_statistics)
+		{
+			i.print_memo_statistics(std::cout);
+		}
+
+		if (!image.empty() && !i.save_image(image, std::cout))
+		{
+			ok = false;
+		}
+
+		return ok ? 0 : 1;
+	}
+
 	std::cout << "Write \"e0\" to exit program.\n\n";
-	run(std::cin, std::cout);
+	run(std::cin, std::cout, i, trace.is_open() ? &trace : nullptr);
+
+	if (memo_statistics)
+	{
+		i.print_memo_statistics(std::cout);
+	}
+
+	if (!image.empty() && !i.save_image(image, std::cout))
+	{
+		return 1;
+	}
 
 	return 0;
-}
\ No newline at end of file
+}
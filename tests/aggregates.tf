@@ -0,0 +1,15 @@
+length(list())
+length(list(1, 2, 3))
+sum(list(1, 2, 3.5))
+sum(list())
+min(list(4, -2, 7))
+max(list(4, -2, 7))
+mean(list(1, 2, 3, 4))
+min(list())
+sort(list(3, 1, 2, 1))
+argsort(list(3, 1, 2, 1))
+sum(range(1, 100001))
+mean(range(0, 100001))
+max(map(sin, range(0, 1000)))
+sort(concat(list(5), list(4, 6)))
+e0
@@ -0,0 +1,5 @@
+neg(3)
+sq(2)
+fact(10)
+sq <- 5
+e0
@@ -0,0 +1,9 @@
+sq <- mul(#0, #0)
+
+sq(3)
+add(1, 2
+map(sq, list(1, 2, 3))
+div(1, 0)
+sq(4)
+e0
+sq(5)
@@ -0,0 +1,4 @@
+sum(list(1, 10000000000000000, 1, -10000000000000000))
+sum(list(10000000000000000, 1, 1, 1, 1, 1, 1, 1, 1, -10000000000000000))
+mean(list(1, 10000000000000000, 1, -10000000000000000))
+e0
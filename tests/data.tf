@@ -0,0 +1,16 @@
+save("numbers.bin", list(1, 2.5, -3, 0.1))
+load("numbers.bin")
+sum(load("numbers.bin"))
+save("range.bin", range(0, 100000))
+length(load("range.bin"))
+head(drop(99999, load("range.bin")))
+savecsv("numbers.csv", list(0.1, 1e-07, 100000))
+csv("numbers.csv", 0)
+csv("data.csv", 1)
+csv("data.csv", 0)
+csv("data.csv", 2)
+load("missing.bin")
+save("empty.bin", list())
+load("empty.bin")
+map(sqrt, take(5, load("range.bin")))
+e0
@@ -0,0 +1,7 @@
+deep <- if(eq(#0, 0), 0, add(1, deep(sub(#0, 1))))
+deep(10)
+deep(1000)
+deep(1000)
+deep(100000)
+deep(200000)
+e0
@@ -0,0 +1,4 @@
+sin(list(mul(-1, 0), 0, 1))
+cos(list(mul(-1, 0), 0))
+map(sin, list(mul(-1, 0), mul(-1, 0), mul(-1, 0), mul(-1, 0), mul(-1, 0)))
+e0
@@ -0,0 +1,29 @@
+div(1, 3)
+add(0.1, 0.2)
+list(0.1, 0.2, div(1, 3))
+sqrt(list(2, 3, 4))
+sin(list(1, 2, 3))
+map(sin, list(1, 2, 3))
+sin(2)
+pow(list(2, 3), 0.5)
+pow(2, 0.5)
+f <- add(mul(#0, #0), 0.1)
+map(f, list(0.1, 0.2, 0.3))
+f(0.3)
+sum(list(0.1, 0.2, 0.3))
+mean(range(0, 1000))
+norm(list(3, 4))
+dot(list(0.1, 0.2), list(0.3, 0.4))
+axpy(0.5, list(1, 2), list(0.1, 0.2))
+matvec(list(1, 2, 3, 4), list(0.1, 0.2))
+concat(list(0.1), list(0.2))
+length(concat(range(0, 300), sqrt(range(0, 300))))
+head(drop(300, concat(range(0, 300), sqrt(range(0, 300)))))
+sum(take(10, drop(295, concat(range(0, 300), sqrt(range(0, 300))))))
+save("numbers.bin", list(0.1, 2.5))
+load("numbers.bin")
+sqrt(load("numbers.bin"))
+sort(list(0.3, 0.1, 0.2))
+zipWith(add, list(0.1, 0.2), list(0.2, 0.3))
+take(3, map(f, range(0, 10)))
+e0
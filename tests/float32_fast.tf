@@ -0,0 +1,5 @@
+sin(list(mul(-1, 0), 0, mul(-1, 0), 0, mul(-1, 0), 0, mul(-1, 0), 0, mul(-1, 0), 0, mul(-1, 0), 0, mul(-1, 0), 0, mul(-1, 0), 0, mul(-1, 0)))
+cos(list(mul(-1, 0), 0, mul(-1, 0), 0, mul(-1, 0), 0, mul(-1, 0), 0, mul(-1, 0), 0, mul(-1, 0), 0, mul(-1, 0), 0, mul(-1, 0), 0, mul(-1, 0)))
+f <- mul(#0, #0)
+sqrt(map(f, range(0, 20)))
+e0
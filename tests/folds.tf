@@ -0,0 +1,19 @@
+reduce(add, list(1, 2, 3, 4))
+reduce(sub, list(10, 1, 2))
+foldl(sub, 100, list(1, 2, 3))
+foldl(add, 5, list())
+reduce(add, list())
+reduce(mul, list(7))
+filter(le, list(3, -1, 0, 2, -5))
+keep <- le(#0, 3)
+filter(keep, list(5, 1, 4, 2, 3))
+zipWith(add, list(1, 2, 3), list(10, 20))
+zipWith(pow, list(2, 3), list(3, 2))
+bigger <- if(le(#0, #1), #1, #0)
+reduce(bigger, list(3, 9, 2, 7))
+foldl(bigger, 100, list(3, 9))
+zipWith(bigger, list(1, 5), list(4, 2))
+inv <- div(1, #0)
+filter(inv, list(1, 0))
+reduce(add, map(sqrt, list(1, 4, 9)))
+e0
@@ -0,0 +1,4 @@
+sq <- mul(#0, #0)
+fib <- if(le(#0, 2), #0, add(fib(sub(#0, 1)), fib(sub(#0, 2))))
+hyp <- sqrt(add(sq(#0), sq(#1)))
+half <- div(#0, 2)
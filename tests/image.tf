@@ -0,0 +1,8 @@
+sq(7)
+fib(30)
+hyp(3, 4)
+map(half, list(1, 2, 3))
+half <- mul(#0, 0.5)
+cube <- mul(#0, sq(#0))
+cube(3)
+e0
@@ -0,0 +1,22 @@
+add(9223372036854775806, 1)
+add(9223372036854775807, 1)
+sub(-9223372036854775807, 2)
+mul(4294967296, 4294967296)
+mul(3037000499, 3037000499)
+pow(2, 62)
+pow(2, 63)
+pow(-2, 63)
+pow(3, -1)
+pow(-1, -3)
+div(7, -2)
+div(-9223372036854775808, -1)
+div(1, 0)
+sqrt(99)
+sqrt(-1)
+fact <- if(eq(#0, 0), 1, mul(#0, fact(sub(#0, 1))))
+fact(20)
+fact(21)
+add(1, 0.5)
+sin(1)
+list(1, 2)
+e0
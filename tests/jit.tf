@@ -0,0 +1,20 @@
+fib <- if(le(#0, 2), #0, add(fib(sub(#0, 1)), fib(sub(#0, 2))))
+fib(20)
+fib(25)
+hyp <- sqrt(add(mul(#0, #0), mul(#1, #1)))
+hyp(3, 4)
+hyp(5, 12)
+zipWith(hyp, list(3, 5, 8), list(4, 12, 15))
+inv <- div(1, #0)
+inv(4)
+inv(0)
+both <- nand(nand(#0, #1), nand(#0, #1))
+both(1, 1)
+both(1, 0)
+clamp <- if(le(10, #0), 10, if(le(#0, 0), 0, #0))
+clamp(-3)
+clamp(4.5)
+clamp(100)
+map(clamp, list(-1, 2, 20))
+fib(22)
+e0
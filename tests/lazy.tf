@@ -0,0 +1,15 @@
+pick <- if(#0, #1, #2)
+pick(1, 2, div(1, 0))
+pick(0, div(1, 0), 3)
+pick(1, div(1, 0), 3)
+nand(0, div(1, 0))
+nand(1, div(1, 0))
+down <- if(le(#0, 1), 0, down(sub(#0, 1)))
+pick(0, down(1000000000), 4)
+twice <- add(#0, #0)
+twice(pick(1, 5, down(1000000000)))
+fib <- if(le(#0, 2), #0, add(fib(sub(#0, 1)), fib(sub(#0, 2))))
+fib(20)
+safe <- if(eq(#0, 0), 0, div(1, #0))
+map(safe, list(0, 2))
+e0
@@ -0,0 +1,19 @@
+dot(list(1, 2, 3), list(4, 5, 6))
+dot(list(), list())
+dot(list(1, 2), list(1, 2, 3))
+norm(list(3, 4))
+norm(list())
+norm(list(1e200, 1e200))
+norm(list(3e-170, 4e-170))
+axpy(2, list(1, 2, 3), list(10, 20, 30))
+axpy(2, list(1), list(1, 2))
+matvec(list(1, 2, 3, 4, 5, 6), list(1, 1))
+matvec(list(1, 0, 0, 1), list(7, 8))
+matvec(list(1, 2, 3, 4, 5), list(1, 1))
+matvec(list(1, 2), list())
+dot(range(1, 4), concat(list(1), list(1, 1)))
+norm(concat(take(1, from(3, 1)), list(4)))
+axpy(-1, drop(1, range(0, 4)), take(3, from(1, 1)))
+matvec(concat(list(1, 2), range(3, 5)), range(1, 3))
+dot(range(0, 100000), range(0, 100000))
+e0
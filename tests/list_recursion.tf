@@ -0,0 +1,11 @@
+r <- if(le(#0, 0), list(1), map(sin, r(sub(#0, 1))))
+head(r(50000))
+c <- if(le(#0, 0), list(0), concat(list(#0), c(sub(#0, 1))))
+length(c(20000))
+head(c(20000))
+f <- if(le(#0, 0), 0, add(1, head(map(f, list(sub(#0, 1))))))
+f(100)
+f(200000)
+g <- if(le(#0, 0), 0, add(1, reduce(add, list(0, g(sub(#0, 1))))))
+g(200000)
+e0
@@ -0,0 +1,6 @@
+fib <- if(le(#0, 2), #0, add(fib(sub(#0, 1)), fib(sub(#0, 2))))
+fib(80)
+fib(80)
+sq <- mul(#0, #0)
+sq(3)
+e0
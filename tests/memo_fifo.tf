@@ -0,0 +1,8 @@
+sq <- mul(#0, #0)
+sq(3)
+sq(4)
+sq(3)
+sq(5)
+sq(3)
+sq(4)
+e0
@@ -0,0 +1,5 @@
+sq <- mul(#0, #0)
+g <- if(le(#0, 2), sq(#0), add(g(sub(#0, 1)), g(sub(#0, 2))))
+g(40)
+f <- if(le(#0, 2), 1, add(f(sub(#0, 1)), f(sub(#0, 2))))
+f(30)
@@ -0,0 +1,5 @@
+g <- if(le(#0, 1), 7, add(g(sub(#0, 1)), g(sub(#0, 2))))
+g(10)
+h <- if(le(#0, 1), div(1, 10), add(h(sub(#0, 1)), h(sub(#0, 2))))
+h(10)
+e0
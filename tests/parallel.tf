@@ -0,0 +1,15 @@
+fib <- if(le(#0, 2), #0, add(fib(sub(#0, 1)), fib(sub(#0, 2))))
+fib(27)
+fib(3)
+div(1, 0)
+fib(25)
+add(1, 2
+fib(1)
+sq <- mul(#0, #0)
+sq(fib(20))
+sum(map(sq, range(0, 100000)))
+save("parallel.bin", list(1, 2, 3))
+sum(load("parallel.bin"))
+fib(26)
+sq(2)
+e0
@@ -0,0 +1,14 @@
+concat(list(1, 2), list(3, 4))
+concat(list(), list(5))
+take(3, concat(list(1, 2), list(3, 4)))
+drop(1, concat(list(1, 2), list(3, 4)))
+take(2, drop(1, concat(concat(list(1, 2), list(3)), list(4, 5))))
+tail(concat(list(1), list(2, 3)))
+take(0, list(1, 2))
+drop(10, list(1, 2))
+head(drop(3, concat(list(1, 2), list(3, 4))))
+build <- if(le(#0, 2), list(1), concat(build(sub(#0, 1)), list(#0)))
+length(build(2000))
+sum(drop(1000, build(2000)))
+head(drop(1999, build(2000)))
+e0
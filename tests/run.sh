@@ -0,0 +1,64 @@
+#!/bin/sh
+# Runs every script in this directory through the interpreter (the first argument) and compares what it prints
+# with the .expected file next to it. A script is run with the options in its .args file, if there is one,
+# and fails if it takes longer than 10 seconds.
+# A script with a .before.args file gets a run with those options (and the .before.tf script, if any) first,
+# e.g. to write the file that the script then reads. That run has to succeed, but what it prints is not compared.
+# A script with a .sed file has its output edited by it before the comparison, e.g. to hide how long something took.
+# Every script runs in a scratch copy of this directory, so the files they write go away afterwards.
+
+interpreter="$1"
+directory=$(cd "$(dirname "$0")" && pwd)
+failed=0
+
+if [ ! -x "$interpreter" ]; then
+	echo "Usage: $0 path/to/thisfunc"
+	exit 2
+fi
+
+interpreter=$(cd "$(dirname "$interpreter")" && pwd)/$(basename "$interpreter")
+
+for script in "$directory"/*.tf; do
+	name=$(basename "$script" .tf)
+
+	case "$name" in
+		*.before) continue ;;
+	esac
+
+	scratch=$(mktemp -d)
+	cp "$directory"/* "$scratch"
+	args=""
+	edit=""
+	ok=1
+
+	if [ -f "$directory/$name.args" ]; then
+		args=$(cat "$directory/$name.args")
+	fi
+
+	if [ -f "$directory/$name.sed" ]; then
+		edit="$directory/$name.sed"
+	fi
+
+	if [ -f "$directory/$name.before.args" ]; then
+		before=""
+
+		if [ -f "$directory/$name.before.tf" ]; then
+			before="$directory/$name.before.tf"
+		fi
+
+		if ! (cd "$scratch" && timeout 10 "$interpreter" $(cat "$directory/$name.before.args") < "${before:-/dev/null}" > /dev/null); then
+			ok=0
+		fi
+	fi
+
+	if [ $ok = 1 ] && (cd "$scratch" && timeout 10 "$interpreter" $args < "$script") | sed -f "${edit:-/dev/null}" | cmp -s - "$directory/$name.expected"; then
+		echo "passed $name"
+	else
+		echo "FAILED $name"
+		failed=1
+	fi
+
+	rm -rf "$scratch"
+done
+
+exit $failed
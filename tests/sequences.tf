@@ -0,0 +1,12 @@
+range(1, 6)
+range(5, 5)
+take(4, from(10, -2.5))
+take(3, drop(1000000, from(0, 1)))
+sum(range(1, 100001))
+length(range(0, 1000))
+map(sqrt, take(3, from(1, 3)))
+sq <- mul(#0, #0)
+take(5, map(sq, from(1, 1)))
+head(drop(999, map(sq, range(1, 2000))))
+concat(take(2, from(1, 1)), range(7, 9))
+e0
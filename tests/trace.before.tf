@@ -0,0 +1,5 @@
+sq <- mul(#0, #0)
+sq(3)
+
+sum(map(sq, list(1, 2, 3)))
+mul(sq(2), 0.5)